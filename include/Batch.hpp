@@ -0,0 +1,386 @@
+/**
+ * @file Batch.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-05-05
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef BATCH_PACS
+#define BATCH_PACS
+
+// Type.
+#include <Type.hpp>
+
+// Matrix.
+#include <Matrix.hpp>
+
+// First-touch storage.
+#include <Memory.hpp>
+
+// Thread pool.
+#ifdef PARALLEL_PACS
+#include <Pool.hpp>
+#endif
+
+// Containers.
+#include <vector>
+
+// Assertions.
+#include <cassert>
+
+// Algorithms.
+#include <algorithm>
+
+// Members per task, a multiple of the vectors' width.
+#ifndef TILE_PACS
+#define TILE_PACS 64
+#endif
+
+namespace pacs {
+
+    namespace algebra {
+
+        /**
+         * @brief A batch of compressed matrices sharing one pattern, values interleaved across tiles of TILE_PACS members: the k-th element of a tile's members is contiguous, and so is each tile.
+         * Batched vectors are interleaved across every member, the j-th entry of every member being contiguous, so that products vectorize across members.
+         *
+         * @tparam T
+         * @tparam O
+         */
+        template<MatrixType T, Order O = Row>
+        class Batch {
+            private:
+
+                std::size_t first, second; // Primary and secondary dimensions.
+                std::size_t count; // Members.
+
+                // Shared pattern.
+                Vector<std::size_t> inner;
+                Vector<std::size_t> outer;
+
+                // Interleaved values, tile by tile: values[start * elements + k * width + member - start], see position.
+                Vector<T> values;
+
+                /**
+                 * @brief Applies a function to every tile of members [start, end), in parallel when enabled.
+                 *
+                 * @param function
+                 */
+                void tiled(const auto &function) const {
+                    const std::size_t tiles = (this->count + TILE_PACS - 1) / TILE_PACS;
+
+                    auto tile = [this, &function](const std::size_t &t) {
+                        function(t * TILE_PACS, std::min((t + 1) * TILE_PACS, this->count));
+                    };
+
+                    each(tiles, tile);
+                }
+
+                /**
+                 * @brief Returns the position of a member's k-th element. Tiles of TILE_PACS members are contiguous, so that each product task streams its own block, and the k-th element of a tile's members is.
+                 *
+                 * @param member
+                 * @param k
+                 * @return std::size_t
+                 */
+                inline std::size_t position(const std::size_t &member, const std::size_t &k) const {
+                    const std::size_t start = member / TILE_PACS * TILE_PACS;
+                    return start * this->outer.size() + k * (std::min(start + TILE_PACS, this->count) - start) + member - start;
+                }
+
+                /**
+                 * @brief Returns a Matrix' general storage.
+                 *
+                 * @param matrix
+                 * @return Matrix<T, O>
+                 */
+                static Matrix<T, O> general(const Matrix<T, O> &matrix) {
+                    Matrix<T, O> expanded = matrix;
+                    expanded.expand();
+
+                    return expanded;
+                }
+
+                /**
+                 * @brief Writes the members [start, end)'s products into results. Full tiles run fixed-width, TILE_PACS, inner loops, so that they vectorize.
+                 *
+                 * @tparam Full
+                 * @param start
+                 * @param end
+                 * @param vectors
+                 * @param results
+                 */
+                template<bool Full>
+                void tile(const std::size_t &start, const std::size_t &end, const std::vector<T> &vectors, std::vector<T> &results) const {
+                    const std::size_t width = Full ? TILE_PACS : end - start;
+                    const T *block = this->values.data() + start * this->outer.size();
+
+                    if constexpr (O == Row) {
+                        T sums[TILE_PACS];
+
+                        for(std::size_t j = 0; j < this->first; ++j) {
+                            for(std::size_t b = 0; b < width; ++b)
+                                sums[b] = static_cast<T>(0);
+
+                            for(std::size_t k = this->inner[j]; k < this->inner[j + 1]; ++k) {
+                                const T *values = block + k * width;
+                                const T *vector = vectors.data() + this->outer[k] * this->count + start;
+
+                                for(std::size_t b = 0; b < width; ++b)
+                                    sums[b] += values[b] * vector[b];
+                            }
+
+                            std::copy(sums, sums + width, results.data() + j * this->count + start);
+                        }
+                    } else {
+                        for(std::size_t j = 0; j < this->second; ++j)
+                            std::fill(results.data() + j * this->count + start, results.data() + j * this->count + start + width, static_cast<T>(0));
+
+                        // Linear combination of columns.
+                        for(std::size_t j = 0; j < this->first; ++j) {
+                            T column[TILE_PACS];
+                            std::copy(vectors.data() + j * this->count + start, vectors.data() + j * this->count + start + width, column);
+
+                            for(std::size_t k = this->inner[j]; k < this->inner[j + 1]; ++k) {
+                                const T *values = block + k * width;
+                                T *result = results.data() + this->outer[k] * this->count + start;
+
+                                for(std::size_t b = 0; b < width; ++b)
+                                    result[b] += values[b] * column[b];
+                            }
+                        }
+                    }
+                }
+
+            public:
+
+                // CONSTRUCTORS.
+
+                /**
+                 * @brief Builds a batch of count copies of a compressed Matrix, whose pattern, expanded if symmetric, the batch shares.
+                 *
+                 * @param matrix
+                 * @param count
+                 */
+                Batch(const Matrix<T, O> &matrix, const std::size_t &count): first{O == Row ? matrix.rows() : matrix.columns()}, second{O == Row ? matrix.columns() : matrix.rows()}, count{count} {
+                    #ifndef NDEBUG
+                    assert(matrix.is_compressed());
+                    assert(count > 0);
+                    #endif
+
+                    const Matrix<T, O> expanded = general(matrix);
+                    const auto &values = expanded.get_values();
+
+                    this->inner.assign(expanded.get_inner().begin(), expanded.get_inner().end());
+                    this->outer.assign(expanded.get_outer().begin(), expanded.get_outer().end());
+                    this->values.resize(values.size() * count);
+
+                    // First touch under the product's tiles.
+                    this->tiled([this, &values](const std::size_t &start, const std::size_t &end) {
+                        for(std::size_t k = 0; k < values.size(); ++k)
+                            std::fill(this->values.begin() + this->position(start, k), this->values.begin() + this->position(start, k) + (end - start), values[k]);
+                    });
+                }
+
+                // MEMBERS.
+
+                /**
+                 * @brief Sets a member's values from a compressed Matrix with the batch's pattern.
+                 *
+                 * @param member
+                 * @param matrix
+                 */
+                void set(const std::size_t &member, const Matrix<T, O> &matrix) {
+                    const Matrix<T, O> expanded = general(matrix);
+                    const auto &values = expanded.get_values();
+
+                    #ifndef NDEBUG
+                    assert(member < this->count);
+                    assert(matrix.is_compressed());
+                    assert(std::ranges::equal(expanded.get_inner(), this->inner) && std::ranges::equal(expanded.get_outer(), this->outer));
+                    #endif
+
+                    for(std::size_t k = 0; k < values.size(); ++k)
+                        this->values[this->position(member, k)] = values[k];
+                }
+
+                /**
+                 * @brief Returns a member as a compressed Matrix.
+                 *
+                 * @param member
+                 * @return Matrix<T, O>
+                 */
+                Matrix<T, O> get(const std::size_t &member) const {
+                    #ifndef NDEBUG
+                    assert(member < this->count);
+                    #endif
+
+                    std::vector<T> values;
+                    values.resize(this->outer.size());
+
+                    for(std::size_t k = 0; k < values.size(); ++k)
+                        values[k] = this->values[this->position(member, k)];
+
+                    return Matrix<T, O>{this->first, this->second, this->inner, this->outer, values};
+                }
+
+                /**
+                 * @brief Returns a member's k-th stored element, in the pattern's order.
+                 *
+                 * @param member
+                 * @param k
+                 * @return T&
+                 */
+                inline T &operator ()(const std::size_t &member, const std::size_t &k) {
+                    #ifndef NDEBUG
+                    assert((member < this->count) && (k < this->outer.size()));
+                    #endif
+
+                    return this->values[this->position(member, k)];
+                }
+
+                /**
+                 * @brief Returns a member's k-th stored element, in the pattern's order.
+                 *
+                 * @param member
+                 * @param k
+                 * @return T
+                 */
+                inline T operator ()(const std::size_t &member, const std::size_t &k) const {
+                    #ifndef NDEBUG
+                    assert((member < this->count) && (k < this->outer.size()));
+                    #endif
+
+                    return this->values[this->position(member, k)];
+                }
+
+                // PRODUCT.
+
+                /**
+                 * @brief Writes every member's Matrix x Vector into results, reusing its storage.
+                 * vectors[j * size() + member] is the j-th entry of member's vector, results are laid out the same way.
+                 *
+                 * @param vectors
+                 * @param results
+                 */
+                void product(const std::vector<T> &vectors, std::vector<T> &results) const {
+                    #ifndef NDEBUG
+                    assert(vectors.size() == this->columns() * this->count);
+                    assert(&vectors != &results);
+                    #endif
+
+                    results.resize(this->rows() * this->count);
+
+                    this->tiled([this, &vectors, &results](const std::size_t &start, const std::size_t &end) {
+                        if(end - start == TILE_PACS)
+                            this->template tile<true>(start, end, vectors, results);
+                        else
+                            this->template tile<false>(start, end, vectors, results);
+                    });
+                }
+
+                /**
+                 * @brief Returns every member's Matrix x Vector, interleaved.
+                 *
+                 * @param vectors
+                 * @return std::vector<T>
+                 */
+                std::vector<T> operator *(const std::vector<T> &vectors) const {
+                    std::vector<T> results;
+                    this->product(vectors, results);
+
+                    return results;
+                }
+
+                // INTERLEAVING.
+
+                /**
+                 * @brief Interleaves one vector per member.
+                 *
+                 * @param vectors
+                 * @return std::vector<T>
+                 */
+                std::vector<T> interleave(const std::vector<std::vector<T>> &vectors) const {
+                    #ifndef NDEBUG
+                    assert(vectors.size() == this->count);
+                    #endif
+
+                    std::vector<T> interleaved;
+                    interleaved.resize(vectors.empty() ? 0 : vectors[0].size() * this->count);
+
+                    for(std::size_t member = 0; member < this->count; ++member) {
+                        for(std::size_t j = 0; j < vectors[member].size(); ++j)
+                            interleaved[j * this->count + member] = vectors[member][j];
+                    }
+
+                    return interleaved;
+                }
+
+                /**
+                 * @brief Extracts a member's vector from interleaved ones.
+                 *
+                 * @param interleaved
+                 * @param member
+                 * @return std::vector<T>
+                 */
+                std::vector<T> extract(const std::vector<T> &interleaved, const std::size_t &member) const {
+                    #ifndef NDEBUG
+                    assert((member < this->count) && (interleaved.size() % this->count == 0));
+                    #endif
+
+                    std::vector<T> vector;
+                    vector.resize(interleaved.size() / this->count);
+
+                    for(std::size_t j = 0; j < vector.size(); ++j)
+                        vector[j] = interleaved[j * this->count + member];
+
+                    return vector;
+                }
+
+                // INFO.
+
+                /**
+                 * @brief Returns the members' number of rows.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t rows() const {
+                    return O == Row ? this->first : this->second;
+                }
+
+                /**
+                 * @brief Returns the members' number of columns.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t columns() const {
+                    return O == Row ? this->second : this->first;
+                }
+
+                /**
+                 * @brief Returns the number of members.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t size() const {
+                    return this->count;
+                }
+
+                /**
+                 * @brief Returns the members' number of stored elements.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t elements() const {
+                    return this->outer.size();
+                }
+        };
+
+    }
+
+}
+
+#endif
@@ -0,0 +1,837 @@
+/**
+ * @file Benchmark.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-04-29
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef BENCHMARK_PACS
+#define BENCHMARK_PACS
+
+// Type.
+#include <Type.hpp>
+
+// Matrix.
+#include <Matrix.hpp>
+
+// Market format.
+#include <Market.hpp>
+
+// Autotuner.
+#include <Tuner.hpp>
+
+// Mixed precision.
+#include <Precision.hpp>
+
+// Packed indices.
+#include <Packed.hpp>
+
+// Sparse vectors.
+#include <Sparse.hpp>
+
+// Batches.
+#include <Batch.hpp>
+
+// Thread pool.
+#ifdef PARALLEL_PACS
+#include <Pool.hpp>
+#endif
+
+// Containers.
+#include <vector>
+#include <string>
+
+// Output.
+#include <iostream>
+#include <iomanip>
+
+// Chrono.
+#include <chrono>
+
+// Files.
+#include <filesystem>
+
+// Algorithms.
+#include <algorithm>
+#include <numeric>
+
+// Math.
+#include <cmath>
+
+// Utilities.
+#include <type_traits>
+
+// First-touch storage.
+#include <Memory.hpp>
+
+// Cache sizes.
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+// Minimum number of samples, regardless of the time budget.
+#ifndef SAMPLES_PACS
+#define SAMPLES_PACS 5
+#endif
+
+namespace pacs {
+
+    namespace algebra {
+
+        /**
+         * @brief Forces the computation of a value the compiler could otherwise discard.
+         *
+         * @tparam V
+         * @param value
+         */
+        template<typename V>
+        inline void sink(const V &value) {
+            #if defined(__GNUC__) || defined(__clang__)
+            asm volatile("" : : "r"(&value) : "memory");
+            #else
+            static const void *volatile address;
+            address = &value;
+            #endif
+        }
+
+        /**
+         * @brief Timing statistics, in seconds per call.
+         *
+         */
+        struct Statistics {
+            std::size_t samples = 0;
+            std::size_t iterations = 0; // Calls per sample.
+
+            double minimum = 0.0;
+            double p10 = 0.0;
+            double median = 0.0;
+            double p90 = 0.0;
+            double maximum = 0.0;
+            double mean = 0.0;
+            double deviation = 0.0;
+
+            /**
+             * @brief Computes the statistics of some samples.
+             *
+             * @param samples
+             * @param iterations
+             */
+            Statistics(std::vector<double> samples, const std::size_t &iterations): samples{samples.size()}, iterations{iterations} {
+                #ifndef NDEBUG
+                assert(!(samples.empty()));
+                #endif
+
+                std::sort(samples.begin(), samples.end());
+
+                // Linearly interpolated percentiles.
+                auto percentile = [&samples](const double &p) {
+                    const double position = p * static_cast<double>(samples.size() - 1);
+                    const std::size_t lower = static_cast<std::size_t>(position);
+                    const std::size_t upper = std::min(lower + 1, samples.size() - 1);
+
+                    return samples[lower] + (position - static_cast<double>(lower)) * (samples[upper] - samples[lower]);
+                };
+
+                this->minimum = samples.front();
+                this->p10 = percentile(0.1);
+                this->median = percentile(0.5);
+                this->p90 = percentile(0.9);
+                this->maximum = samples.back();
+                this->mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+
+                for(const auto &sample: samples)
+                    this->deviation += (sample - this->mean) * (sample - this->mean);
+
+                this->deviation = std::sqrt(this->deviation / static_cast<double>(std::max(samples.size() - 1, static_cast<std::size_t>(1))));
+            }
+
+            Statistics() = default;
+        };
+
+        /**
+         * @brief A benchmark's description, cost model and timings.
+         * Flops and bytes are per call, the latter being the minimum traffic a kernel needs, so that throughputs are effective ones.
+         *
+         */
+        struct Measurement {
+            std::string kernel;
+            std::string format;
+            std::string order;
+            std::size_t threads = 1;
+
+            // Storage backed by huge pages, see Memory.hpp.
+            bool huge = false;
+
+            std::size_t rows = 0;
+            std::size_t columns = 0;
+            std::size_t nonzeros = 0;
+
+            double flops = 0.0;
+            double bytes = 0.0;
+
+            Statistics seconds;
+
+            // Fraction of the attainable roofline, if calibrated, at most 1.
+            double roofline = 0.0;
+
+            // Working set resident in cache, where the roofline's DRAM bandwidth does not apply.
+            bool resident = false;
+
+            /**
+             * @brief Returns the GFLOP/s at the median time.
+             *
+             * @return double
+             */
+            inline double gflops() const {
+                return this->flops / this->seconds.median / 1E9;
+            }
+
+            /**
+             * @brief Returns the effective GB/s at the median time.
+             *
+             * @return double
+             */
+            inline double bandwidth() const {
+                return this->bytes / this->seconds.median / 1E9;
+            }
+        };
+
+        /**
+         * @brief Achievable machine limits for a number of threads, as measured by Benchmark::calibrate.
+         *
+         */
+        struct Machine {
+            std::size_t threads = 0;
+            double bandwidth = 0.0; // STREAM triad, GB/s.
+            double peak = 0.0; // Independent multiply-add chains, GFLOP/s.
+            std::size_t cache = 0; // Last level cache, bytes, 0 if unknown.
+
+            /**
+             * @brief Returns a measurement's fraction of the roofline: the time its flops and bytes need at the machine's limits over its median time.
+             *
+             * @param measurement
+             * @return double
+             */
+            double fraction(const Measurement &measurement) const {
+                if((this->bandwidth <= 0.0) || (this->peak <= 0.0))
+                    return 0.0;
+
+                const double bound = std::max(measurement.flops / (this->peak * 1E9), measurement.bytes / (this->bandwidth * 1E9));
+                return bound / measurement.seconds.median;
+            }
+
+            /**
+             * @brief Sets a measurement's roofline fraction, flagging it as cache resident if its bytes fit in the last level cache or it beats the DRAM roofline.
+             * Fractions of resident measurements are clamped to 1, as their actual bound is a cache's bandwidth, which the probe does not measure.
+             *
+             * @param measurement
+             */
+            void assess(Measurement &measurement) const {
+                const double fraction = this->fraction(measurement);
+
+                measurement.resident = (fraction > 1.0) || ((fraction > 0.0) && (measurement.bytes > 0.0) && (measurement.bytes <= static_cast<double>(this->cache)));
+                measurement.roofline = std::min(fraction, 1.0);
+            }
+
+            /**
+             * @brief Returns the ridge point's arithmetic intensity, flop/B.
+             *
+             * @return double
+             */
+            inline double ridge() const {
+                return this->peak / this->bandwidth;
+            }
+        };
+
+        /**
+         * @brief Statistical timer: warms kernels up, batches fast ones so that each sample lasts at least a given time and collects samples within a time budget.
+         *
+         */
+        class Benchmark {
+            private:
+
+                using Clock = std::chrono::steady_clock;
+
+                std::vector<Measurement> measurements;
+                std::vector<Machine> machines;
+
+                // HELPERS.
+
+                /**
+                 * @brief Returns the current number of threads.
+                 *
+                 * @return std::size_t
+                 */
+                static inline std::size_t threads() {
+                    #ifdef PARALLEL_PACS
+                    return Pool::instance().threads();
+                    #else
+                    return 1;
+                    #endif
+                }
+
+                /**
+                 * @brief Calls a kernel, sinking its result.
+                 *
+                 * @param kernel
+                 * @param arguments
+                 */
+                static inline void call(const auto &kernel, auto &...arguments) {
+                    if constexpr (std::is_void_v<decltype(kernel(arguments...))>) {
+                        kernel(arguments...);
+                        sink(kernel);
+                    } else
+                        sink(kernel(arguments...));
+                }
+
+                /**
+                 * @brief Returns the elapsed seconds since a given time.
+                 *
+                 * @param start
+                 * @return double
+                 */
+                static inline double since(const Clock::time_point &start) {
+                    return std::chrono::duration<double>(Clock::now() - start).count();
+                }
+
+            public:
+
+                // Settings.
+                std::size_t samples;
+                std::size_t warmups;
+                double batch; // Minimum seconds per sample.
+                double budget; // Seconds per kernel.
+
+                // CONSTRUCTORS.
+
+                /**
+                 * @brief Benchmark's constructor.
+                 *
+                 * @param samples
+                 * @param warmups
+                 * @param batch
+                 * @param budget
+                 */
+                Benchmark(const std::size_t &samples = 25, const std::size_t &warmups = 2, const double &batch = 1E-3, const double &budget = 0.5):
+                samples{samples}, warmups{warmups}, batch{batch}, budget{budget} {}
+
+                // RUNS.
+
+                /**
+                 * @brief Times a stateless kernel, in batches.
+                 *
+                 * @param measurement
+                 * @param kernel
+                 * @return const Measurement&
+                 */
+                const Measurement &run(Measurement measurement, const auto &kernel) {
+                    for(std::size_t j = 0; j < this->warmups; ++j)
+                        call(kernel);
+
+                    // Calibration.
+                    std::size_t iterations = 1;
+
+                    while(true) {
+                        const auto start = Clock::now();
+
+                        for(std::size_t j = 0; j < iterations; ++j)
+                            call(kernel);
+
+                        if(since(start) >= this->batch)
+                            break;
+
+                        iterations *= 2;
+                    }
+
+                    // Samples.
+                    std::vector<double> samples;
+                    const auto begin = Clock::now();
+
+                    while((samples.size() < this->samples) && ((samples.size() < SAMPLES_PACS) || (since(begin) < this->budget))) {
+                        const auto start = Clock::now();
+
+                        for(std::size_t j = 0; j < iterations; ++j)
+                            call(kernel);
+
+                        samples.emplace_back(since(start) / static_cast<double>(iterations));
+                    }
+
+                    measurement.seconds = Statistics{samples, iterations};
+                    this->machine().assess(measurement);
+                    this->measurements.emplace_back(measurement);
+
+                    return this->measurements.back();
+                }
+
+                /**
+                 * @brief Times a kernel on a fresh state, built by an untimed setup before each call.
+                 *
+                 * @param measurement
+                 * @param setup
+                 * @param kernel Called on setup()'s result.
+                 * @return const Measurement&
+                 */
+                const Measurement &run(Measurement measurement, const auto &setup, const auto &kernel) {
+                    for(std::size_t j = 0; j < this->warmups; ++j) {
+                        auto state = setup();
+                        call(kernel, state);
+                    }
+
+                    // Samples.
+                    std::vector<double> samples;
+                    const auto begin = Clock::now();
+
+                    while((samples.size() < this->samples) && ((samples.size() < SAMPLES_PACS) || (since(begin) < this->budget))) {
+                        auto state = setup();
+                        const auto start = Clock::now();
+
+                        call(kernel, state);
+
+                        samples.emplace_back(since(start));
+                    }
+
+                    measurement.seconds = Statistics{samples, 1};
+                    this->machine().assess(measurement);
+                    this->measurements.emplace_back(measurement);
+
+                    return this->measurements.back();
+                }
+
+                // CALIBRATION.
+
+                /**
+                 * @brief Measures the achievable bandwidth and peak for the current number of threads, recording both probes.
+                 * Bandwidth comes from a STREAM triad, a = b + s * c, over three arrays of a given size, first-touched under the triad's own partition; peak from independent multiply-add chains, per thread.
+                 *
+                 * @param size Elements per array, well past the last level cache.
+                 * @param ost
+                 * @return const Machine&
+                 */
+                const Machine &calibrate(const std::size_t &size = 1 << 24, std::ostream &ost = std::cout) {
+                    const std::size_t count = threads();
+
+                    Machine machine;
+                    machine.threads = count;
+
+                    Measurement base;
+                    base.format = "-";
+                    base.order = "-";
+                    base.threads = count;
+
+                    // STREAM triad.
+                    Vector<double> a, b, c;
+                    a.resize(size);
+                    b.resize(size);
+                    c.resize(size);
+
+                    each(count, [&a, &b, &c, &size, &count](const std::size_t &t) {
+                        for(std::size_t j = t * size / count; j < (t + 1) * size / count; ++j) {
+                            a[j] = 0.0;
+                            b[j] = 1.0;
+                            c[j] = 2.0;
+                        }
+                    });
+
+                    const double scalar = 3.0;
+
+                    Measurement triad = base;
+                    triad.kernel = "stream_triad";
+                    triad.flops = 2.0 * static_cast<double>(size);
+                    triad.bytes = 3.0 * sizeof(double) * static_cast<double>(size);
+
+                    triad = this->run(triad, [&a, &b, &c, &size, &count, &scalar]() {
+                        each(count, [&a, &b, &c, &size, &count, &scalar](const std::size_t &t) {
+                            for(std::size_t j = t * size / count; j < (t + 1) * size / count; ++j)
+                                a[j] = b[j] + scalar * c[j];
+                        });
+
+                        return a.data();
+                    });
+
+                    machine.bandwidth = triad.bytes / triad.seconds.minimum / 1E9;
+
+                    // Peak, 32 independent chains per thread.
+                    constexpr std::size_t chains = 32, repetitions = 1 << 14;
+
+                    Measurement peak = base;
+                    peak.kernel = "peak_flops";
+                    peak.flops = 2.0 * chains * repetitions * static_cast<double>(count);
+
+                    peak = this->run(peak, [&count]() {
+                        each(count, [](const std::size_t &t) {
+                            alignas(64) std::array<double, chains> x;
+
+                            for(std::size_t k = 0; k < chains; ++k)
+                                x[k] = 1E-3 * static_cast<double>(k + t);
+
+                            for(std::size_t r = 0; r < repetitions; ++r) {
+                                for(std::size_t k = 0; k < chains; ++k)
+                                    x[k] = x[k] * 0.999999 + 1E-6;
+                            }
+
+                            sink(x);
+                        });
+                    });
+
+                    machine.peak = peak.flops / peak.seconds.minimum / 1E9;
+
+                    // Last level cache.
+                    #if defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE)
+                    machine.cache = static_cast<std::size_t>(std::max({::sysconf(_SC_LEVEL3_CACHE_SIZE), ::sysconf(_SC_LEVEL2_CACHE_SIZE), 0L}));
+                    #endif
+
+                    // Probes against the new roofline.
+                    this->machines.emplace_back(machine);
+                    machine.assess(this->measurements[this->measurements.size() - 2]);
+                    machine.assess(this->measurements.back());
+
+                    ost << "Calibrated " << count << " thread(s): " << std::fixed << std::setprecision(3) << machine.bandwidth << " GB/s (STREAM triad), " << machine.peak << " GFLOP/s (peak), ridge at " << machine.ridge() << " flop/B." << std::defaultfloat << std::endl;
+
+                    return this->machines.back();
+                }
+
+                /**
+                 * @brief Returns the latest calibration for the current number of threads, an empty Machine if none.
+                 *
+                 * @return Machine
+                 */
+                Machine machine() const {
+                    const std::size_t count = threads();
+
+                    for(auto it = this->machines.rbegin(); it != this->machines.rend(); ++it) {
+                        if(it->threads == count)
+                            return *it;
+                    }
+
+                    return Machine{};
+                }
+
+                // OUTPUT.
+
+                /**
+                 * @brief Prints the table's header.
+                 *
+                 * @param ost
+                 */
+                static void header(std::ostream &ost) {
+                    ost << std::left << std::setw(18) << "kernel" << std::setw(8) << "format" << std::setw(8) << "order" << std::right << std::setw(8) << "threads";
+                    ost << std::setw(12) << "median [s]" << std::setw(12) << "p10 [s]" << std::setw(12) << "p90 [s]" << std::setw(10) << "GFLOP/s" << std::setw(10) << "GB/s" << std::setw(10) << "roof [%]" << std::endl;
+                }
+
+                /**
+                 * @brief Prints a measurement as a table row.
+                 *
+                 * @param ost
+                 * @param measurement
+                 */
+                static void row(std::ostream &ost, const Measurement &measurement) {
+                    ost << std::left << std::setw(18) << measurement.kernel << std::setw(8) << (measurement.format + (measurement.huge ? "+HP" : "")) << std::setw(8) << measurement.order << std::right << std::setw(8) << measurement.threads;
+                    ost << std::scientific << std::setprecision(3) << std::setw(12) << measurement.seconds.median << std::setw(12) << measurement.seconds.p10 << std::setw(12) << measurement.seconds.p90;
+                    ost << std::fixed << std::setprecision(3) << std::setw(10) << measurement.gflops() << std::setw(10) << measurement.bandwidth() << std::setw(10) << 100.0 * measurement.roofline << (measurement.resident ? " cached" : "") << std::defaultfloat << std::endl;
+                }
+
+                /**
+                 * @brief Writes the measurements as JSON.
+                 *
+                 * @param ost
+                 */
+                void json(std::ostream &ost) const {
+                    ost << "{\n";
+                    ost << "  \"compiler\": \"" << __VERSION__ << "\",\n";
+
+                    #ifdef PARALLEL_PACS
+                    ost << "  \"parallel\": true,\n";
+                    #else
+                    ost << "  \"parallel\": false,\n";
+                    #endif
+
+                    #ifdef NDEBUG
+                    ost << "  \"debug\": false,\n";
+                    #else
+                    ost << "  \"debug\": true,\n";
+                    #endif
+
+                    ost << "  \"machines\": [";
+
+                    for(std::size_t j = 0; j < this->machines.size(); ++j)
+                        ost << (j ? ",\n" : "\n") << std::setprecision(9) << "    {\"threads\": " << this->machines[j].threads << ", \"bandwidth\": " << this->machines[j].bandwidth << ", \"peak\": " << this->machines[j].peak << ", \"cache\": " << this->machines[j].cache << "}";
+
+                    ost << "\n  ],\n";
+                    ost << "  \"measurements\": [";
+
+                    for(std::size_t j = 0; j < this->measurements.size(); ++j) {
+                        const Measurement &measurement = this->measurements[j];
+                        const Statistics &seconds = measurement.seconds;
+
+                        ost << (j ? ",\n" : "\n") << "    {";
+                        ost << "\"kernel\": \"" << measurement.kernel << "\", \"format\": \"" << measurement.format << "\", \"order\": \"" << measurement.order << "\", \"threads\": " << measurement.threads << ", ";
+                        ost << "\"rows\": " << measurement.rows << ", \"columns\": " << measurement.columns << ", \"nonzeros\": " << measurement.nonzeros << ", ";
+                        ost << std::setprecision(9) << "\"flops\": " << measurement.flops << ", \"bytes\": " << measurement.bytes << ", ";
+                        ost << "\"samples\": " << seconds.samples << ", \"iterations\": " << seconds.iterations << ", ";
+                        ost << "\"seconds\": {\"minimum\": " << seconds.minimum << ", \"p10\": " << seconds.p10 << ", \"median\": " << seconds.median << ", \"p90\": " << seconds.p90;
+                        ost << ", \"maximum\": " << seconds.maximum << ", \"mean\": " << seconds.mean << ", \"deviation\": " << seconds.deviation << "}, ";
+                        ost << "\"gflops\": " << measurement.gflops() << ", \"bandwidth\": " << measurement.bandwidth() << ", \"roofline\": " << measurement.roofline << ", \"resident\": " << (measurement.resident ? "true" : "false") << ", \"huge\": " << (measurement.huge ? "true" : "false") << "}";
+                    }
+
+                    ost << "\n  ]\n}" << std::defaultfloat << std::endl;
+                }
+
+                /**
+                 * @brief Writes the measurements as CSV.
+                 *
+                 * @param ost
+                 */
+                void csv(std::ostream &ost) const {
+                    ost << "kernel,format,order,threads,rows,columns,nonzeros,flops,bytes,samples,iterations,minimum,p10,median,p90,maximum,mean,deviation,gflops,bandwidth,roofline,resident,huge\n";
+                    ost << std::setprecision(9);
+
+                    for(const auto &measurement: this->measurements) {
+                        const Statistics &seconds = measurement.seconds;
+
+                        ost << measurement.kernel << "," << measurement.format << "," << measurement.order << "," << measurement.threads << ",";
+                        ost << measurement.rows << "," << measurement.columns << "," << measurement.nonzeros << "," << measurement.flops << "," << measurement.bytes << ",";
+                        ost << seconds.samples << "," << seconds.iterations << "," << seconds.minimum << "," << seconds.p10 << "," << seconds.median << "," << seconds.p90 << ",";
+                        ost << seconds.maximum << "," << seconds.mean << "," << seconds.deviation << "," << measurement.gflops() << "," << measurement.bandwidth() << "," << measurement.roofline << "," << measurement.resident << "," << measurement.huge << "\n";
+                    }
+
+                    ost << std::defaultfloat << std::flush;
+                }
+
+                /**
+                 * @brief Returns the measurements.
+                 *
+                 * @return const std::vector<Measurement>&
+                 */
+                inline const std::vector<Measurement> &results() const {
+                    return this->measurements;
+                }
+        };
+
+        /**
+         * @brief Returns the number of scalar multiplications in a Matrix x Matrix product.
+         *
+         * @tparam T
+         * @tparam O
+         * @param first
+         * @param second
+         * @return std::size_t
+         */
+        template<MatrixType T, Order O>
+        std::size_t multiplications(Matrix<T, O> first, Matrix<T, O> second) {
+            first.compress();
+            second.compress();
+            first.expand();
+            second.expand();
+
+            // Row: each A_ik meets B's k-th row; Column: each B_kj meets A's k-th column.
+            const Matrix<T, O> &left = O == Row ? first : second;
+            const Matrix<T, O> &right = O == Row ? second : first;
+
+            std::size_t multiplications = 0;
+
+            for(const auto &k: left.get_outer())
+                multiplications += right.get_inner()[k + 1] - right.get_inner()[k];
+
+            return multiplications;
+        }
+
+        /**
+         * @brief Returns the number of scalar multiplications in a Matrix x Matrix product within a mask's pattern.
+         *
+         * @tparam T
+         * @tparam O
+         * @param first
+         * @param second
+         * @param mask
+         * @return std::size_t
+         */
+        template<MatrixType T, Order O>
+        std::size_t multiplications(Matrix<T, O> first, Matrix<T, O> second, Matrix<T, O> mask) {
+            for(Matrix<T, O> *general: {&first, &second, &mask}) {
+                general->compress();
+                general->expand();
+            }
+
+            const Matrix<T, O> &left = O == Row ? first : second;
+            const Matrix<T, O> &right = O == Row ? second : first;
+
+            std::vector<bool> allowed;
+            allowed.resize(O == Row ? mask.columns() : mask.rows(), false);
+
+            std::size_t multiplications = 0;
+
+            for(std::size_t j = 0; j + 1 < left.get_inner().size(); ++j) {
+                for(std::size_t h = mask.get_inner()[j]; h < mask.get_inner()[j + 1]; ++h)
+                    allowed[mask.get_outer()[h]] = true;
+
+                for(std::size_t h = left.get_inner()[j]; h < left.get_inner()[j + 1]; ++h) {
+                    const std::size_t k = left.get_outer()[h];
+
+                    for(std::size_t i = right.get_inner()[k]; i < right.get_inner()[k + 1]; ++i)
+                        multiplications += allowed[right.get_outer()[i]];
+                }
+
+                for(std::size_t h = mask.get_inner()[j]; h < mask.get_inner()[j + 1]; ++h)
+                    allowed[mask.get_outer()[h]] = false;
+            }
+
+            return multiplications;
+        }
+
+        /**
+         * @brief Benchmarks a Matrix' kernels in its current format: products, scalar operations, norms, compression and market I/O.
+         *
+         * @tparam T
+         * @tparam O
+         * @param benchmark
+         * @param matrix
+         */
+        template<MatrixType T, Order O>
+        void benchmark(Benchmark &benchmark, const Matrix<T, O> &matrix, std::ostream &ost = std::cout) {
+            constexpr double value = sizeof(T);
+            constexpr double index = sizeof(std::size_t);
+
+            const double nonzeros = static_cast<double>(matrix.size());
+            const double slices = static_cast<double>((O == Row ? matrix.rows() : matrix.columns()) + 1);
+            const double storage = nonzeros * (value + index) + slices * index;
+
+            Measurement base;
+            base.format = !(matrix.is_compressed()) ? "COO" : (O == Row ? "CSR" : "CSC");
+            base.order = O == Row ? "Row" : "Column";
+            base.rows = matrix.rows();
+            base.columns = matrix.columns();
+            base.nonzeros = matrix.size();
+            base.huge = matrix.is_compressed() && matrix.get_values().get_allocator().huge;
+
+            #ifdef PARALLEL_PACS
+            base.threads = Pool::instance().threads();
+            #endif
+
+            auto measure = [&benchmark, &ost, &base](const std::string &kernel, const double &flops, const double &bytes, const auto &...functions) {
+                Measurement measurement = base;
+                measurement.kernel = kernel;
+                measurement.flops = flops;
+                measurement.bytes = bytes;
+
+                Benchmark::row(ost, benchmark.run(measurement, functions...));
+            };
+
+            std::vector<T> vector, result;
+            vector.resize(matrix.columns(), static_cast<T>(1.5));
+
+            // Matrix x Vector.
+            measure("spmv", 2.0 * nonzeros, storage + static_cast<double>(matrix.rows() + matrix.columns()) * value, [&matrix, &vector]() { return matrix * vector; });
+
+            if(matrix.is_compressed()) {
+                result.resize(matrix.rows());
+                measure("spmv_product", 2.0 * nonzeros, storage + static_cast<double>(matrix.rows() + matrix.columns()) * value, [&matrix, &vector, &result]() { matrix.product(vector, result); return result.data(); });
+
+                // Tuned, named after its kernel.
+                const Operator<T, O> tuned = tune(matrix);
+                std::string kernel = "spmv_" + name(tuned.kernel().kernel);
+
+                if(tuned.kernel().kernel == Kernel::Blocked)
+                    kernel += std::to_string(tuned.kernel().block);
+
+                measure(kernel, 2.0 * nonzeros, storage + static_cast<double>(matrix.rows() + matrix.columns()) * value, [&tuned, &vector, &result]() { tuned.product(vector, result); return result.data(); });
+
+                // Narrow values, expanded and by rows.
+                if constexpr (std::is_floating_point_v<T>) {
+                    const Mixed<T, float, O> single{matrix};
+                    const Mixed<T, BFloat16, O> brain{matrix};
+                    const double elements = static_cast<double>(single.size()), vectors = static_cast<double>(matrix.rows() + matrix.columns()) * value + static_cast<double>(matrix.rows() + 1) * index;
+
+                    measure("spmv_float", 2.0 * elements, elements * (sizeof(float) + index) + vectors, [&single, &vector, &result]() { single.product(vector, result); return result.data(); });
+                    measure("spmv_bfloat16", 2.0 * elements, elements * (sizeof(BFloat16) + index) + vectors, [&brain, &vector, &result]() { brain.product(vector, result); return result.data(); });
+                }
+
+                // Packed indices, expanded and by rows.
+                const Packed<T, O> packed{matrix};
+                const double elements = static_cast<double>(packed.size());
+
+                measure("spmv_packed", 2.0 * elements, elements * value + static_cast<double>(packed.index_bytes()) + static_cast<double>(matrix.rows() + matrix.columns()) * value, [&packed, &vector, &result]() { packed.product(vector, result); return result.data(); });
+
+                // Copies of the Matrix, batched against one product per member, with up to 2^22 elements overall.
+                const std::size_t count = std::clamp<std::size_t>((static_cast<std::size_t>(1) << 22) / std::max<std::size_t>(packed.size(), 1), 1, 4096);
+                const Batch<T, O> batch{matrix, count};
+                const double members = static_cast<double>(count), stored = static_cast<double>(batch.elements());
+
+                std::vector<Matrix<T, O>> copies;
+                std::vector<std::vector<T>> inputs, products;
+
+                for(std::size_t m = 0; m < count; ++m)
+                    copies.emplace_back(matrix * static_cast<T>(m + 1));
+
+                inputs.resize(count, vector);
+                products.resize(count);
+
+                std::vector<T> vectors, results;
+                vectors.resize(batch.columns() * count, static_cast<T>(1.5));
+
+                measure("spmv_batched", 2.0 * stored * members, members * (stored * value + static_cast<double>(matrix.rows() + matrix.columns()) * value) + stored * index, [&batch, &vectors, &results]() { batch.product(vectors, results); return results.data(); });
+                measure("spmv_members", 2.0 * nonzeros * members, members * (storage + static_cast<double>(matrix.rows() + matrix.columns()) * value), [&copies, &inputs, &products]() { for(std::size_t m = 0; m < copies.size(); ++m) copies[m].product(inputs[m], products[m]); return products.back().data(); });
+
+                // Sparse vector, one column in a thousand.
+                if constexpr (O == Column) {
+                    SparseVector<T> selection{matrix.columns()}, selected{matrix.rows()};
+
+                    for(std::size_t j = 0; j < matrix.columns(); j += 1000)
+                        selection.push(j, static_cast<T>(1.5));
+
+                    double products = 0.0;
+
+                    for(const auto &j: selection.get_indices())
+                        products += static_cast<double>(matrix.get_inner()[j + 1] - matrix.get_inner()[j]);
+
+                    measure("spmspv", 2.0 * products, products * (value + index) + static_cast<double>(selection.nonzeros()) * (value + 3.0 * index), [&matrix, &selection, &selected]() { spmspv(matrix, selection, selected); return selected.nonzeros(); });
+                }
+            }
+
+            // Vector x Matrix.
+            if(matrix.rows() == matrix.columns())
+                measure("spmv_transposed", 2.0 * nonzeros, storage + static_cast<double>(matrix.rows() + matrix.columns()) * value, [&matrix, &vector]() { return vector * matrix; });
+
+            // Matrix x Matrix.
+            if(matrix.rows() == matrix.columns()) {
+                const double products = static_cast<double>(multiplications(matrix, matrix));
+                const double produced = static_cast<double>((matrix * matrix).size());
+
+                measure("spgemm", 2.0 * products, 2.0 * storage + produced * (value + index) + slices * index, [&matrix]() { return matrix * matrix; });
+
+                // Masked by its own pattern, as in triangle counting.
+                const double masked = static_cast<double>(multiplications(matrix, matrix, matrix));
+                const double kept = static_cast<double>(matrix.masked(matrix, matrix).size());
+
+                measure("spgemm_masked", 2.0 * masked, 3.0 * storage + kept * (value + index) + slices * index, [&matrix]() { return matrix.masked(matrix, matrix); });
+            }
+
+            // Matrix x Scalar.
+            const T scalar = static_cast<T>(1.5);
+            measure("scale", nonzeros, storage + nonzeros * (value + index) + slices * index, [&matrix, &scalar]() { return matrix * scalar; });
+
+            // Norms.
+            measure("norms", 3.0 * nonzeros, storage, [&matrix]() { return matrix.measure(); });
+
+            // Compression, from a fresh COOmap copy.
+            if(!(matrix.is_compressed()))
+                measure("compress", 0.0, storage, [&matrix]() { return matrix; }, [](Matrix<T, O> &copy) { copy.compress(); });
+
+            // Market I/O.
+            const std::string filename = (std::filesystem::temp_directory_path() / "pacs_benchmark.mtx").string();
+            market(matrix, filename);
+            const double file = static_cast<double>(std::filesystem::file_size(filename));
+
+            measure("market_dump", 0.0, file, [&matrix, &filename]() { market(matrix, filename); });
+            measure("market_load", 0.0, file, [&filename]() { return market<T, O>(filename); });
+
+            std::filesystem::remove(filename);
+        }
+
+    }
+
+}
+
+#endif
@@ -0,0 +1,439 @@
+/**
+ * @file Counters.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-05-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef COUNTERS_PACS
+#define COUNTERS_PACS
+
+// Containers.
+#include <array>
+#include <map>
+#include <string>
+
+// Output.
+#include <iostream>
+#include <iomanip>
+
+// Concurrency.
+#include <mutex>
+#include <atomic>
+
+// Chrono.
+#include <chrono>
+
+// Integers.
+#include <cstdint>
+
+// Performance counters.
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace pacs {
+
+    namespace algebra {
+
+        /**
+         * @brief Hardware events' counts.
+         *
+         */
+        struct Events {
+            // Cycles, instructions, last level cache misses, branch misses.
+            static constexpr std::array<const char *, 4> names = {"cycles", "instructions", "llc_misses", "branch_misses"};
+
+            std::array<std::uint64_t, 4> counts{};
+
+            Events &operator +=(const Events &events) {
+                for(std::size_t j = 0; j < this->counts.size(); ++j)
+                    this->counts[j] += events.counts[j];
+
+                return *this;
+            }
+
+            Events operator -(const Events &events) const {
+                Events result;
+
+                for(std::size_t j = 0; j < this->counts.size(); ++j)
+                    result.counts[j] = this->counts[j] - events.counts[j];
+
+                return result;
+            }
+        };
+
+        /**
+         * @brief A thread's free-running perf_event_open counters, user space only.
+         * Events the kernel or the hardware refuse read as zero.
+         *
+         */
+        class Counter {
+            private:
+
+                std::array<int, 4> descriptors{-1, -1, -1, -1};
+                std::size_t identifier;
+
+                /**
+                 * @brief Opens the thread's counters.
+                 *
+                 */
+                Counter() {
+                    static std::atomic<std::size_t> threads{0};
+                    this->identifier = threads++;
+
+                    #ifdef __linux__
+                    constexpr std::array<std::uint64_t, 4> configs = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+                    for(std::size_t j = 0; j < configs.size(); ++j) {
+                        perf_event_attr attributes{};
+                        attributes.type = PERF_TYPE_HARDWARE;
+                        attributes.size = sizeof(perf_event_attr);
+                        attributes.config = configs[j];
+                        attributes.exclude_kernel = 1;
+                        attributes.exclude_hv = 1;
+
+                        this->descriptors[j] = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+                    }
+                    #endif
+                }
+
+            public:
+
+                Counter(const Counter &) = delete;
+                Counter &operator =(const Counter &) = delete;
+
+                ~Counter() {
+                    #ifdef __linux__
+                    for(const auto &descriptor: this->descriptors) {
+                        if(descriptor >= 0)
+                            close(descriptor);
+                    }
+                    #endif
+                }
+
+                /**
+                 * @brief Returns the calling thread's counters.
+                 *
+                 * @return Counter&
+                 */
+                static Counter &local() {
+                    thread_local Counter counter;
+                    return counter;
+                }
+
+                /**
+                 * @brief Reads the counters.
+                 *
+                 * @return Events
+                 */
+                Events read() const {
+                    Events events;
+
+                    #ifdef __linux__
+                    for(std::size_t j = 0; j < this->descriptors.size(); ++j) {
+                        if((this->descriptors[j] < 0) || (::read(this->descriptors[j], &events.counts[j], sizeof(std::uint64_t)) != sizeof(std::uint64_t)))
+                            events.counts[j] = 0;
+                    }
+                    #endif
+
+                    return events;
+                }
+
+                /**
+                 * @brief Returns whether any counter is available.
+                 *
+                 * @return true
+                 * @return false
+                 */
+                bool is_available() const {
+                    for(const auto &descriptor: this->descriptors) {
+                        if(descriptor >= 0)
+                            return true;
+                    }
+
+                    return false;
+                }
+
+                /**
+                 * @brief Returns the thread's identifier, by first use.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t thread() const {
+                    return this->identifier;
+                }
+        };
+
+        /**
+         * @brief Kernels' aggregated counts.
+         *
+         */
+        struct Record {
+            std::size_t calls = 0;
+            double seconds = 0.0;
+
+            // Cost model.
+            double nonzeros = 0.0;
+            double flops = 0.0;
+            double bytes = 0.0;
+
+            Events total;
+            std::map<std::size_t, Events> threads;
+        };
+
+        /**
+         * @brief Registry of kernels' records.
+         *
+         */
+        class Profile {
+            private:
+
+                std::mutex mutex;
+                std::map<std::string, Record> records;
+
+                Profile() = default;
+
+            public:
+
+                Profile(const Profile &) = delete;
+                Profile &operator =(const Profile &) = delete;
+
+                /**
+                 * @brief Returns the library's profile.
+                 *
+                 * @return Profile&
+                 */
+                static Profile &instance() {
+                    static Profile profile;
+                    return profile;
+                }
+
+                /**
+                 * @brief Adds an invocation to a kernel's record.
+                 *
+                 * @param kernel
+                 * @param record Invocation's record.
+                 */
+                void add(const std::string &kernel, const Record &record) {
+                    std::lock_guard<std::mutex> lock{this->mutex};
+                    Record &target = this->records[kernel];
+
+                    target.calls += record.calls;
+                    target.seconds += record.seconds;
+                    target.nonzeros += record.nonzeros;
+                    target.flops += record.flops;
+                    target.bytes += record.bytes;
+                    target.total += record.total;
+
+                    for(const auto &[thread, events]: record.threads)
+                        target.threads[thread] += events;
+                }
+
+                /**
+                 * @brief Drops every record.
+                 *
+                 */
+                void reset() {
+                    std::lock_guard<std::mutex> lock{this->mutex};
+                    this->records.clear();
+                }
+
+                /**
+                 * @brief Returns a copy of the records.
+                 *
+                 * @return std::map<std::string, Record>
+                 */
+                std::map<std::string, Record> results() {
+                    std::lock_guard<std::mutex> lock{this->mutex};
+                    return this->records;
+                }
+
+                /**
+                 * @brief Prints the records: per kernel totals, intensities and per thread counts.
+                 *
+                 * @param ost
+                 */
+                void report(std::ostream &ost = std::cout) {
+                    std::lock_guard<std::mutex> lock{this->mutex};
+
+                    if(!(Counter::local().is_available()))
+                        ost << "Hardware counters unavailable, see /proc/sys/kernel/perf_event_paranoid." << std::endl;
+
+                    ost << std::left << std::setw(18) << "kernel" << std::right << std::setw(8) << "calls" << std::setw(12) << "seconds" << std::setw(12) << "nonzeros" << std::setw(12) << "GB";
+
+                    for(const auto &name: Events::names)
+                        ost << std::setw(15) << name;
+
+                    ost << std::setw(8) << "IPC" << std::setw(10) << "flop/B" << std::setw(10) << "B/miss" << std::endl;
+
+                    for(const auto &[kernel, record]: this->records) {
+                        const double cycles = static_cast<double>(record.total.counts[0]);
+                        const double misses = static_cast<double>(record.total.counts[2]);
+
+                        ost << std::left << std::setw(18) << kernel << std::right << std::setw(8) << record.calls;
+                        ost << std::scientific << std::setprecision(3) << std::setw(12) << record.seconds << std::setw(12) << record.nonzeros << std::setw(12) << record.bytes / 1E9;
+
+                        for(const auto &count: record.total.counts)
+                            ost << std::setw(15) << count;
+
+                        ost << std::fixed << std::setprecision(2) << std::setw(8) << (cycles > 0.0 ? static_cast<double>(record.total.counts[1]) / cycles : 0.0);
+                        ost << std::setw(10) << (record.bytes > 0.0 ? record.flops / record.bytes : 0.0) << std::setw(10) << (misses > 0.0 ? record.bytes / misses : 0.0) << std::defaultfloat << std::endl;
+
+                        for(const auto &[thread, events]: record.threads) {
+                            ost << std::left << std::setw(18) << ("  thread " + std::to_string(thread)) << std::right << std::setw(44) << "";
+
+                            for(const auto &count: events.counts)
+                                ost << std::setw(15) << count;
+
+                            ost << std::endl;
+                        }
+                    }
+                }
+        };
+
+        /**
+         * @brief Measures a kernel's invocation from construction to destruction, on its calling thread and on every thread running its pool's chunks.
+         *
+         */
+        class Probe {
+            private:
+
+                std::string kernel;
+                Record record;
+
+                std::size_t owner;
+                Events start;
+                std::chrono::steady_clock::time_point begin;
+
+                std::mutex mutex;
+                Probe *previous;
+
+                // Calling thread's innermost probe.
+                static inline thread_local Probe *current = nullptr;
+
+            public:
+
+                /**
+                 * @brief Starts measuring.
+                 *
+                 * @param kernel
+                 * @param nonzeros
+                 * @param flops
+                 * @param bytes
+                 */
+                Probe(const std::string &kernel, const double &nonzeros, const double &flops, const double &bytes): kernel{kernel}, previous{current} {
+                    this->record.calls = 1;
+                    this->record.nonzeros = nonzeros;
+                    this->record.flops = flops;
+                    this->record.bytes = bytes;
+
+                    this->owner = Counter::local().thread();
+                    current = this;
+
+                    this->begin = std::chrono::steady_clock::now();
+                    this->start = Counter::local().read();
+                }
+
+                Probe(const Probe &) = delete;
+                Probe &operator =(const Probe &) = delete;
+
+                /**
+                 * @brief Stops measuring and records the invocation.
+                 *
+                 */
+                ~Probe() {
+                    const Events events = Counter::local().read() - this->start;
+                    this->record.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - this->begin).count();
+
+                    this->add(this->owner, events);
+                    current = this->previous;
+
+                    Profile::instance().add(this->kernel, this->record);
+                }
+
+                /**
+                 * @brief Adds some counts from a thread.
+                 *
+                 * @param thread
+                 * @param events
+                 */
+                void add(const std::size_t &thread, const Events &events) {
+                    std::lock_guard<std::mutex> lock{this->mutex};
+
+                    this->record.total += events;
+                    this->record.threads[thread] += events;
+                }
+
+                /**
+                 * @brief Adds to the cost model, when known after the kernel's start.
+                 *
+                 * @param flops
+                 * @param bytes
+                 */
+                void account(const double &flops, const double &bytes) {
+                    this->record.flops += flops;
+                    this->record.bytes += bytes;
+                }
+
+                /**
+                 * @brief Returns the calling thread's innermost probe.
+                 *
+                 * @return Probe*
+                 */
+                static inline Probe *active() {
+                    return current;
+                }
+
+                /**
+                 * @brief Attributes a task's counts to a probe, unless it runs on the probe's own thread, which is already measured.
+                 *
+                 */
+                class Scope {
+                    private:
+
+                        Probe *probe;
+                        Probe *previous;
+                        Events start;
+
+                    public:
+
+                        /**
+                         * @brief Starts measuring a task.
+                         *
+                         * @param probe
+                         */
+                        Scope(Probe *probe): probe{probe}, previous{current} {
+                            if(this->probe && (this->probe->owner == Counter::local().thread()))
+                                this->probe = nullptr;
+
+                            if(!(this->probe))
+                                return;
+
+                            current = this->probe;
+                            this->start = Counter::local().read();
+                        }
+
+                        Scope(const Scope &) = delete;
+                        Scope &operator =(const Scope &) = delete;
+
+                        ~Scope() {
+                            if(!(this->probe))
+                                return;
+
+                            this->probe->add(Counter::local().thread(), Counter::local().read() - this->start);
+                            current = this->previous;
+                        }
+                };
+        };
+
+    }
+
+}
+
+#endif
@@ -0,0 +1,1020 @@
+/**
+ * @file Direct.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-04-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef DIRECT_PACS
+#define DIRECT_PACS
+
+// Type.
+#include <Type.hpp>
+
+// Matrix.
+#include <Matrix.hpp>
+
+// Reordering.
+#include <Reordering.hpp>
+
+// Conjugation.
+#include <Solvers.hpp>
+
+// Containers.
+#include <vector>
+#include <queue>
+#include <utility>
+
+// Assertions.
+#include <cassert>
+
+// Algorithms.
+#include <algorithm>
+#include <numeric>
+
+// Math.
+#include <cmath>
+#include <complex>
+
+// Dense nodes' threshold, times the square root of the size.
+#ifndef DENSE_PACS
+#define DENSE_PACS 10
+#endif
+
+namespace pacs {
+
+    namespace algebra {
+
+        // Ordering.
+
+        /**
+         * @brief Fill-reducing approximate minimum degree ordering of a square matrix, returns the permutation (new to old).
+         * Eliminated nodes become elements of a quotient graph, absorbing the elements they touch and those their elimination covers. Degrees are bounded through the elements' weights outside the newest one, nodes with identical neighbourhoods are merged and eliminated together, and nodes left with no neighbours but the newest element are eliminated with it. Nodes above DENSE_PACS sqrt(n) neighbours are ordered last. Elements are emitted in postorder along their absorptions.
+         *
+         * @tparam T
+         * @tparam O
+         * @param matrix
+         * @return std::vector<std::size_t>
+         */
+        template<MatrixType T, Order O>
+        std::vector<std::size_t> minimum_degree(const Matrix<T, O> &matrix) {
+            const Graph graph{matrix};
+            const std::size_t size = graph.size();
+            const std::size_t none = size;
+
+            // Quotient graph: nodes' neighbouring nodes and elements, elements' nodes.
+            std::vector<std::vector<std::size_t>> adjacent, attached, members;
+            adjacent.resize(size);
+            attached.resize(size);
+            members.resize(size);
+
+            // Nodes' weights, zero once merged, eliminated or deferred, and degrees. Elements' weights and absorbers.
+            std::vector<std::size_t> weight, degree, extent, parent;
+            weight.assign(size, 1);
+            degree.resize(size);
+            extent.assign(size, 0);
+            parent.assign(size, none);
+
+            std::vector<bool> live;
+            live.assign(size, false);
+
+            // Nodes eliminated along with each node.
+            std::vector<std::vector<std::size_t>> merged;
+            merged.resize(size);
+
+            // Minimum degree queue, stale entries skipped.
+            std::priority_queue<std::pair<std::size_t, std::size_t>, std::vector<std::pair<std::size_t, std::size_t>>, std::greater<std::pair<std::size_t, std::size_t>>> queue;
+
+            const std::size_t dense = static_cast<std::size_t>(DENSE_PACS * std::sqrt(static_cast<double>(size)));
+            std::vector<std::size_t> deferred;
+            std::size_t remaining = 0;
+
+            for(std::size_t j = 0; j < size; ++j) {
+                adjacent[j].assign(graph.outer.begin() + graph.inner[j], graph.outer.begin() + graph.inner[j + 1]);
+
+                if(adjacent[j].size() > dense) {
+                    weight[j] = 0;
+                    deferred.emplace_back(j);
+                    adjacent[j].clear();
+                } else
+                    ++remaining;
+            }
+
+            for(std::size_t j = 0; j < size; ++j) {
+                if(weight[j] == 0)
+                    continue;
+
+                std::erase_if(adjacent[j], [&weight](const std::size_t &k) { return weight[k] == 0; });
+                degree[j] = adjacent[j].size();
+                queue.emplace(degree[j], j);
+            }
+
+            // Stamps for nodes and elements, elements' weights outside the newest one.
+            std::vector<std::size_t> seen, visited, difference, external, pivots;
+            seen.assign(size, 0);
+            visited.assign(size, 0);
+            difference.resize(size);
+            external.resize(size);
+
+            std::vector<std::size_t> element;
+            std::vector<std::pair<std::size_t, std::size_t>> hashes;
+            std::size_t stamp = 0;
+
+            while(remaining > 0) {
+                const auto [key, pivot] = queue.top();
+                queue.pop();
+
+                if((weight[pivot] == 0) || (degree[pivot] != key))
+                    continue;
+
+                pivots.emplace_back(pivot);
+                remaining -= weight[pivot];
+                weight[pivot] = 0;
+                seen[pivot] = ++stamp;
+
+                // The new element: the pivot's nodes and its elements' ones, which it absorbs.
+                element.clear();
+                std::size_t total = 0;
+
+                auto gather = [&weight, &seen, &stamp, &element, &total](const std::vector<std::size_t> &nodes) {
+                    for(const auto &node: nodes) {
+                        if((weight[node] > 0) && (seen[node] != stamp)) {
+                            seen[node] = stamp;
+                            element.emplace_back(node);
+                            total += weight[node];
+                        }
+                    }
+                };
+
+                gather(adjacent[pivot]);
+
+                for(const auto &e: attached[pivot]) {
+                    if(!(live[e]))
+                        continue;
+
+                    gather(members[e]);
+                    live[e] = false;
+                    parent[e] = pivot;
+                    std::vector<std::size_t>{}.swap(members[e]);
+                }
+
+                std::vector<std::size_t>{}.swap(adjacent[pivot]);
+                std::vector<std::size_t>{}.swap(attached[pivot]);
+
+                // Weights of the elements' nodes outside the new element.
+                for(const auto &node: element) {
+                    for(const auto &e: attached[node]) {
+                        if(!(live[e]))
+                            continue;
+
+                        if(visited[e] != stamp) {
+                            visited[e] = stamp;
+                            difference[e] = extent[e];
+                        }
+
+                        difference[e] -= weight[node];
+                    }
+                }
+
+                // Neighbourhoods, pruned of absorbed elements and of the new element's nodes.
+                hashes.clear();
+
+                for(const auto &node: element) {
+                    std::size_t outside = 0, hash = 0;
+
+                    std::erase_if(attached[node], [&live, &difference, &parent, &outside, &hash, &pivot](const std::size_t &e) {
+                        if(!(live[e]))
+                            return true;
+
+                        if(difference[e] == 0) { // Covered by the new element.
+                            live[e] = false;
+                            parent[e] = pivot;
+                            return true;
+                        }
+
+                        outside += difference[e];
+                        hash += e;
+                        return false;
+                    });
+
+                    std::erase_if(adjacent[node], [&weight, &seen, &stamp, &outside, &hash](const std::size_t &k) {
+                        if((weight[k] == 0) || (seen[k] == stamp))
+                            return true;
+
+                        outside += weight[k];
+                        hash += k;
+                        return false;
+                    });
+
+                    if(attached[node].empty() && adjacent[node].empty()) { // Eliminated along with the pivot.
+                        total -= weight[node];
+                        remaining -= weight[node];
+                        weight[node] = 0;
+
+                        merged[pivot].emplace_back(node);
+                        merged[pivot].insert(merged[pivot].end(), merged[node].begin(), merged[node].end());
+                        std::vector<std::size_t>{}.swap(merged[node]);
+                        continue;
+                    }
+
+                    attached[node].emplace_back(pivot);
+                    external[node] = outside;
+                    hashes.emplace_back(hash, node);
+                }
+
+                // Nodes sharing their neighbourhood, merged.
+                std::ranges::sort(hashes);
+
+                for(std::size_t h = 0; h < hashes.size(); ++h) {
+                    const std::size_t node = hashes[h].second;
+
+                    if(weight[node] == 0)
+                        continue;
+
+                    ++stamp;
+
+                    for(const auto &e: attached[node])
+                        visited[e] = stamp;
+
+                    for(const auto &k: adjacent[node])
+                        seen[k] = stamp;
+
+                    for(std::size_t g = h + 1; (g < hashes.size()) && (hashes[g].first == hashes[h].first); ++g) {
+                        const std::size_t other = hashes[g].second;
+
+                        if((weight[other] == 0) || (attached[other].size() != attached[node].size()) || (adjacent[other].size() != adjacent[node].size()))
+                            continue;
+
+                        if(!(std::ranges::all_of(attached[other], [&visited, &stamp](const std::size_t &e) { return visited[e] == stamp; })))
+                            continue;
+
+                        if(!(std::ranges::all_of(adjacent[other], [&seen, &stamp](const std::size_t &k) { return seen[k] == stamp; })))
+                            continue;
+
+                        weight[node] += weight[other];
+                        weight[other] = 0;
+
+                        merged[node].emplace_back(other);
+                        merged[node].insert(merged[node].end(), merged[other].begin(), merged[other].end());
+                        std::vector<std::size_t>{}.swap(merged[other]);
+                        std::vector<std::size_t>{}.swap(adjacent[other]);
+                        std::vector<std::size_t>{}.swap(attached[other]);
+                    }
+                }
+
+                // Approximate degrees.
+                std::erase_if(element, [&weight](const std::size_t &node) { return weight[node] == 0; });
+
+                for(const auto &node: element) {
+                    degree[node] = std::min({degree[node] + total - weight[node], external[node] + total - weight[node], remaining - weight[node]});
+                    queue.emplace(degree[node], node);
+                }
+
+                extent[pivot] = total;
+                live[pivot] = !(element.empty());
+                members[pivot].swap(element);
+            }
+
+            // Children in elimination order.
+            std::vector<std::vector<std::size_t>> children;
+            children.resize(size);
+
+            for(const auto &pivot: pivots) {
+                if(parent[pivot] != none)
+                    children[parent[pivot]].emplace_back(pivot);
+            }
+
+            // Postorder.
+            std::vector<std::size_t> permutation;
+            std::vector<std::pair<std::size_t, std::size_t>> stack;
+            permutation.reserve(size);
+
+            for(const auto &root: pivots) {
+                if(parent[root] != none)
+                    continue;
+
+                stack.emplace_back(root, 0);
+
+                while(!(stack.empty())) {
+                    auto &[node, child] = stack.back();
+
+                    if(child < children[node].size()) {
+                        const std::size_t next = children[node][child++];
+                        stack.emplace_back(next, 0);
+                        continue;
+                    }
+
+                    permutation.emplace_back(node);
+                    permutation.insert(permutation.end(), merged[node].begin(), merged[node].end());
+                    stack.pop_back();
+                }
+            }
+
+            permutation.insert(permutation.end(), deferred.begin(), deferred.end());
+            return permutation;
+        }
+
+        // Symbolic analysis.
+
+        /**
+         * @brief Symbolic Cholesky analysis: fill-reducing ordering, elimination tree, column counts and fundamental supernodes.
+         * It depends on the pattern only and can be shared by factorizations of matrices with the same pattern.
+         *
+         */
+        class Symbolic {
+            public:
+
+                // Ordering, new to old and old to new.
+                std::vector<std::size_t> permutation;
+                std::vector<std::size_t> inverse;
+
+                // Elimination tree.
+                std::vector<std::size_t> parent;
+
+                // Non zero elements per column of L, diagonal included.
+                std::vector<std::size_t> counts;
+
+                // Supernodes' first columns and column-to-supernode map.
+                std::vector<std::size_t> supernodes;
+                std::vector<std::size_t> supernode;
+
+                // Supernodes' row structures.
+                std::vector<std::size_t> structure_inner;
+                std::vector<std::size_t> structure_outer;
+
+                // Dense panels' offsets.
+                std::vector<std::size_t> panels;
+
+                // CONSTRUCTORS.
+
+                /**
+                 * @brief Analyses the pattern of a square, structurally symmetric matrix.
+                 *
+                 * @tparam T
+                 * @tparam O
+                 * @param matrix
+                 */
+                template<MatrixType T, Order O>
+                Symbolic(const Matrix<T, O> &matrix): permutation{minimum_degree(matrix)} {
+                    const std::size_t size = matrix.rows();
+                    const std::size_t none = size;
+
+                    this->inverse.resize(size);
+
+                    for(std::size_t j = 0; j < size; ++j)
+                        this->inverse[this->permutation[j]] = j;
+
+                    Matrix<T, O> permuted = matrix.permute(this->permutation, this->permutation);
+                    permuted.compress();
+
+                    // Lower triangular rows: primary j, secondary k < j.
+                    const auto &inner = permuted.get_inner();
+                    const auto &outer = permuted.get_outer();
+
+                    // Elimination tree, Liu's algorithm with path compression.
+                    std::vector<std::size_t> ancestor;
+                    this->parent.assign(size, none);
+                    ancestor.assign(size, none);
+
+                    for(std::size_t j = 0; j < size; ++j) {
+                        for(std::size_t h = inner[j]; (h < inner[j + 1]) && (outer[h] < j); ++h) {
+                            for(std::size_t k = outer[h]; (k != none) && (k < j);) {
+                                const std::size_t next = ancestor[k];
+                                ancestor[k] = j;
+
+                                if(next == none)
+                                    this->parent[k] = j;
+
+                                k = next;
+                            }
+                        }
+                    }
+
+                    // Column counts and patterns through row subtrees.
+                    std::vector<std::size_t> marker, column_inner, column_outer, position;
+                    marker.assign(size, none);
+                    this->counts.assign(size, 1);
+
+                    for(std::size_t pass = 0; pass < 2; ++pass) {
+                        if(pass == 1) {
+                            column_inner.resize(size + 1, 0);
+                            std::inclusive_scan(this->counts.begin(), this->counts.end(), column_inner.begin() + 1);
+                            column_outer.resize(column_inner.back());
+                            position.assign(column_inner.begin(), column_inner.end() - 1);
+                            marker.assign(size, none);
+                        }
+
+                        for(std::size_t j = 0; j < size; ++j) {
+                            marker[j] = j;
+
+                            if(pass == 1)
+                                column_outer[position[j]++] = j;
+
+                            for(std::size_t h = inner[j]; (h < inner[j + 1]) && (outer[h] < j); ++h) {
+                                for(std::size_t k = outer[h]; marker[k] != j; k = this->parent[k]) {
+                                    marker[k] = j;
+
+                                    if(pass == 0)
+                                        ++this->counts[k];
+                                    else
+                                        column_outer[position[k]++] = j;
+                                }
+                            }
+                        }
+                    }
+
+                    // Fundamental supernodes.
+                    std::vector<std::size_t> children;
+                    children.assign(size, 0);
+
+                    for(std::size_t j = 0; j < size; ++j) {
+                        if(this->parent[j] != none)
+                            ++children[this->parent[j]];
+                    }
+
+                    this->supernode.resize(size);
+
+                    for(std::size_t j = 0; j < size; ++j) {
+                        const bool merge = (j > 0) && (this->parent[j - 1] == j) && (this->counts[j - 1] == this->counts[j] + 1) && (children[j] == 1);
+
+                        if(!merge)
+                            this->supernodes.emplace_back(j);
+
+                        this->supernode[j] = this->supernodes.size() - 1;
+                    }
+
+                    this->supernodes.emplace_back(size);
+
+                    // Row structures and panels.
+                    this->structure_inner.emplace_back(0);
+                    this->panels.emplace_back(0);
+
+                    for(std::size_t s = 0; s + 1 < this->supernodes.size(); ++s) {
+                        const std::size_t first = this->supernodes[s], width = this->supernodes[s + 1] - first;
+
+                        this->structure_outer.insert(this->structure_outer.end(), column_outer.begin() + column_inner[first], column_outer.begin() + column_inner[first + 1]);
+                        this->structure_inner.emplace_back(this->structure_outer.size());
+                        this->panels.emplace_back(this->panels.back() + width * this->counts[first]);
+                    }
+                }
+
+                /**
+                 * @brief Returns the number of supernodes.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t size() const {
+                    return this->supernodes.size() - 1;
+                }
+
+                /**
+                 * @brief Returns the number of non zero elements of L.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t fill() const {
+                    return std::accumulate(this->counts.begin(), this->counts.end(), static_cast<std::size_t>(0));
+                }
+        };
+
+        // Factorizations.
+
+        /**
+         * @brief Supernodal sparse Cholesky factorization, P A P^T = L L^H, for Hermitian positive definite matrices.
+         * Left-looking: each supernode gathers its descendants' updates through dense panel products, then factorizes its dense panel.
+         *
+         * @tparam T
+         */
+        template<MatrixType T>
+        class Cholesky {
+            private:
+
+                // Symbolic analysis.
+                Symbolic symbolic;
+
+                // Dense column-major panels.
+                std::vector<T> values;
+
+                // Positive definiteness.
+                bool definite = false;
+
+            public:
+
+                // CONSTRUCTORS.
+
+                /**
+                 * @brief Analyses and factorizes a matrix.
+                 *
+                 * @tparam O
+                 * @param matrix
+                 */
+                template<Order O>
+                Cholesky(const Matrix<T, O> &matrix): symbolic{matrix} {
+                    this->factorize(matrix);
+                }
+
+                /**
+                 * @brief Factorizes a matrix reusing an existing analysis.
+                 *
+                 * @tparam O
+                 * @param symbolic
+                 * @param matrix
+                 */
+                template<Order O>
+                Cholesky(const Symbolic &symbolic, const Matrix<T, O> &matrix): symbolic{symbolic} {
+                    this->factorize(matrix);
+                }
+
+                // FACTORIZATION.
+
+                /**
+                 * @brief Numeric factorization of a matrix sharing the analysed pattern.
+                 *
+                 * @tparam O
+                 * @param matrix
+                 * @return true
+                 * @return false Not positive definite.
+                 */
+                template<Order O>
+                bool factorize(const Matrix<T, O> &matrix) {
+                    const Symbolic &symbolic = this->symbolic;
+                    const std::size_t size = symbolic.parent.size(), count = symbolic.size(), none = count;
+
+                    Matrix<T, O> permuted = matrix.permute(symbolic.permutation, symbolic.permutation);
+                    permuted.compress();
+
+                    const auto &inner = permuted.get_inner();
+                    const auto &outer = permuted.get_outer();
+                    const auto &entries = permuted.get_values();
+
+                    this->values.assign(symbolic.panels.back(), static_cast<T>(0));
+                    this->definite = true;
+
+                    // Rows' local positions, descendants' lists and progress.
+                    std::vector<std::size_t> map, head, link, next;
+                    std::vector<T> update;
+                    map.resize(size);
+                    head.assign(count, none);
+                    link.assign(count, none);
+                    next.assign(count, 0);
+
+                    for(std::size_t s = 0; s < count; ++s) {
+                        const std::size_t first = symbolic.supernodes[s], last = symbolic.supernodes[s + 1], width = last - first;
+                        const std::size_t *rows = symbolic.structure_outer.data() + symbolic.structure_inner[s];
+                        const std::size_t height = symbolic.structure_inner[s + 1] - symbolic.structure_inner[s];
+                        T *panel = this->values.data() + symbolic.panels[s];
+
+                        for(std::size_t i = 0; i < height; ++i)
+                            map[rows[i]] = i;
+
+                        // Assembly of the lower columns, conjugated when read from rows.
+                        for(std::size_t c = first; c < last; ++c) {
+                            for(std::size_t h = inner[c]; h < inner[c + 1]; ++h) {
+                                if(outer[h] >= c)
+                                    panel[(c - first) * height + map[outer[h]]] += O == Row ? conjugate(entries[h]) : entries[h];
+                            }
+                        }
+
+                        // Descendants' updates.
+                        for(std::size_t d = head[s]; d != none;) {
+                            const std::size_t following = link[d];
+                            const std::size_t *descendant_rows = symbolic.structure_outer.data() + symbolic.structure_inner[d];
+                            const std::size_t descendant_height = symbolic.structure_inner[d + 1] - symbolic.structure_inner[d];
+                            const std::size_t descendant_width = symbolic.supernodes[d + 1] - symbolic.supernodes[d];
+                            const T *descendant = this->values.data() + symbolic.panels[d];
+
+                            const std::size_t start = next[d];
+                            std::size_t end = start;
+
+                            while((end < descendant_height) && (descendant_rows[end] < last))
+                                ++end;
+
+                            // Dense product, C = L_d[start:, :] L_d[start:end, :]^H, lower part.
+                            const std::size_t m = descendant_height - start, n = end - start;
+                            update.assign(m * n, static_cast<T>(0));
+
+                            for(std::size_t k = 0; k < n; ++k) {
+                                for(std::size_t t = 0; t < descendant_width; ++t) {
+                                    const T *column = descendant + t * descendant_height + start;
+                                    const T coefficient = conjugate(column[k]);
+
+                                    for(std::size_t i = k; i < m; ++i)
+                                        update[k * m + i] += column[i] * coefficient;
+                                }
+                            }
+
+                            // Scattering.
+                            for(std::size_t k = 0; k < n; ++k) {
+                                T *target = panel + (descendant_rows[start + k] - first) * height;
+
+                                for(std::size_t i = k; i < m; ++i)
+                                    target[map[descendant_rows[start + i]]] -= update[k * m + i];
+                            }
+
+                            // Relinks the descendant to its next ancestor.
+                            next[d] = end;
+
+                            if(end < descendant_height) {
+                                const std::size_t ancestor = symbolic.supernode[descendant_rows[end]];
+                                link[d] = head[ancestor];
+                                head[ancestor] = d;
+                            }
+
+                            d = following;
+                        }
+
+                        // Dense panel factorization.
+                        for(std::size_t k = 0; k < width; ++k) {
+                            T *column = panel + k * height;
+                            const double pivot = std::real(column[k]);
+
+                            if(pivot <= 0.0) {
+                                this->definite = false;
+                                return false;
+                            }
+
+                            column[k] = static_cast<T>(std::sqrt(pivot));
+
+                            for(std::size_t i = k + 1; i < height; ++i)
+                                column[i] /= column[k];
+
+                            for(std::size_t j = k + 1; j < width; ++j) {
+                                T *target = panel + j * height;
+                                const T coefficient = conjugate(column[j]);
+
+                                for(std::size_t i = j; i < height; ++i)
+                                    target[i] -= column[i] * coefficient;
+                            }
+                        }
+
+                        // Links the supernode to its first ancestor.
+                        next[s] = width;
+
+                        if(height > width) {
+                            const std::size_t ancestor = symbolic.supernode[rows[width]];
+                            link[s] = head[ancestor];
+                            head[ancestor] = s;
+                        }
+                    }
+
+                    return true;
+                }
+
+                // SOLUTION.
+
+                /**
+                 * @brief Solves A x = b.
+                 *
+                 * @param b
+                 * @param x
+                 */
+                void solve(const std::vector<T> &b, std::vector<T> &x) const {
+                    #ifndef NDEBUG
+                    assert(this->definite);
+                    assert(b.size() == this->symbolic.parent.size());
+                    #endif
+
+                    const Symbolic &symbolic = this->symbolic;
+                    std::vector<T> y = permute(b, symbolic.permutation);
+
+                    // Forward, L y = P b.
+                    for(std::size_t s = 0; s < symbolic.size(); ++s) {
+                        const std::size_t first = symbolic.supernodes[s], width = symbolic.supernodes[s + 1] - first;
+                        const std::size_t *rows = symbolic.structure_outer.data() + symbolic.structure_inner[s];
+                        const std::size_t height = symbolic.structure_inner[s + 1] - symbolic.structure_inner[s];
+                        const T *panel = this->values.data() + symbolic.panels[s];
+
+                        for(std::size_t k = 0; k < width; ++k) {
+                            const T *column = panel + k * height;
+                            y[first + k] /= column[k];
+
+                            for(std::size_t i = k + 1; i < height; ++i)
+                                y[rows[i]] -= column[i] * y[first + k];
+                        }
+                    }
+
+                    // Backward, L^H z = y.
+                    for(std::size_t s = symbolic.size(); s-- > 0;) {
+                        const std::size_t first = symbolic.supernodes[s], width = symbolic.supernodes[s + 1] - first;
+                        const std::size_t *rows = symbolic.structure_outer.data() + symbolic.structure_inner[s];
+                        const std::size_t height = symbolic.structure_inner[s + 1] - symbolic.structure_inner[s];
+                        const T *panel = this->values.data() + symbolic.panels[s];
+
+                        for(std::size_t k = width; k-- > 0;) {
+                            const T *column = panel + k * height;
+                            T sum = y[first + k];
+
+                            for(std::size_t i = k + 1; i < height; ++i)
+                                sum -= conjugate(column[i]) * y[rows[i]];
+
+                            y[first + k] = sum / column[k];
+                        }
+                    }
+
+                    x = unpermute(y, symbolic.permutation);
+                }
+
+                /**
+                 * @brief Preconditioner interface, exact solve.
+                 *
+                 * @param residual
+                 * @param result
+                 */
+                void apply(const std::vector<T> &residual, std::vector<T> &result) const {
+                    this->solve(residual, result);
+                }
+
+                /**
+                 * @brief Returns whether the last factorization succeeded.
+                 *
+                 * @return true
+                 * @return false
+                 */
+                inline bool is_definite() const {
+                    return this->definite;
+                }
+
+                /**
+                 * @brief Returns the symbolic analysis.
+                 *
+                 * @return const Symbolic&
+                 */
+                inline const Symbolic &analysis() const {
+                    return this->symbolic;
+                }
+        };
+
+        /**
+         * @brief Sparse LU factorization with partial pivoting, P A Q = L U, left-looking (Gilbert-Peierls), column by column without supernodes.
+         * The column ordering Q comes from the symbolic analysis and can be reused, row pivoting is numeric.
+         *
+         * @tparam T
+         */
+        template<MatrixType T>
+        class LU {
+            private:
+
+                // Column ordering, new to old.
+                std::vector<std::size_t> ordering;
+
+                // Row pivoting, old to new.
+                std::vector<std::size_t> pivots;
+
+                // Unit lower L and upper U, by columns. U's diagonal is the last element of each column.
+                std::vector<std::size_t> lower_inner, lower_outer, upper_inner, upper_outer;
+                std::vector<T> lower_values, upper_values;
+
+                // Non singularity.
+                bool regular = false;
+
+            public:
+
+                // CONSTRUCTORS.
+
+                /**
+                 * @brief Analyses and factorizes a matrix.
+                 *
+                 * @tparam O
+                 * @param matrix
+                 */
+                template<Order O>
+                LU(const Matrix<T, O> &matrix): ordering{minimum_degree(matrix)} {
+                    this->factorize(matrix);
+                }
+
+                /**
+                 * @brief Factorizes a matrix reusing an existing analysis' ordering.
+                 *
+                 * @tparam O
+                 * @param symbolic
+                 * @param matrix
+                 */
+                template<Order O>
+                LU(const Symbolic &symbolic, const Matrix<T, O> &matrix): ordering{symbolic.permutation} {
+                    this->factorize(matrix);
+                }
+
+                // FACTORIZATION.
+
+                /**
+                 * @brief Numeric factorization.
+                 *
+                 * @tparam O
+                 * @param matrix
+                 * @return true
+                 * @return false Singular matrix.
+                 */
+                template<Order O>
+                bool factorize(const Matrix<T, O> &matrix) {
+                    #ifndef NDEBUG
+                    assert(matrix.rows() == matrix.columns());
+                    #endif
+
+                    const std::size_t size = matrix.rows(), none = size;
+
+                    // Columns of A as primary slices.
+                    Matrix<T, O> columns = O == Column ? matrix : matrix.transpose();
+                    columns.expand();
+                    columns.compress();
+
+                    const auto &inner = columns.get_inner();
+                    const auto &outer = columns.get_outer();
+                    const auto &entries = columns.get_values();
+
+                    this->pivots.assign(size, none);
+                    this->lower_inner.assign(1, 0);
+                    this->upper_inner.assign(1, 0);
+                    this->lower_outer.clear();
+                    this->upper_outer.clear();
+                    this->lower_values.clear();
+                    this->upper_values.clear();
+                    this->regular = true;
+
+                    std::vector<T> x;
+                    std::vector<std::size_t> marker, reach, stack, position;
+                    x.assign(size, static_cast<T>(0));
+                    marker.assign(size, none);
+                    position.resize(size);
+
+                    for(std::size_t k = 0; k < size; ++k) {
+                        const std::size_t column = this->ordering[k];
+
+                        // Symbolic, topological reach of A(:, column) in the graph of L.
+                        reach.clear();
+
+                        for(std::size_t h = inner[column]; h < inner[column + 1]; ++h) {
+                            if(marker[outer[h]] == k)
+                                continue;
+
+                            stack.assign(1, outer[h]);
+                            marker[outer[h]] = k;
+                            position[outer[h]] = this->pivots[outer[h]] == none ? 0 : this->lower_inner[this->pivots[outer[h]]] + 1;
+
+                            while(!(stack.empty())) {
+                                const std::size_t node = stack.back();
+                                const std::size_t end = this->pivots[node] == none ? 0 : this->lower_inner[this->pivots[node] + 1];
+                                bool done = true;
+
+                                for(; position[node] < end; ++position[node]) {
+                                    const std::size_t child = this->lower_outer[position[node]];
+
+                                    if(marker[child] != k) {
+                                        marker[child] = k;
+                                        position[child] = this->pivots[child] == none ? 0 : this->lower_inner[this->pivots[child]] + 1;
+                                        stack.emplace_back(child);
+                                        ++position[node];
+                                        done = false;
+                                        break;
+                                    }
+                                }
+
+                                if(done) {
+                                    reach.emplace_back(node);
+                                    stack.pop_back();
+                                }
+                            }
+                        }
+
+                        // Numeric, sparse triangular solve in reverse post-order.
+                        for(std::size_t h = inner[column]; h < inner[column + 1]; ++h)
+                            x[outer[h]] = entries[h];
+
+                        for(std::size_t p = reach.size(); p-- > 0;) {
+                            const std::size_t j = reach[p];
+
+                            if(this->pivots[j] == none)
+                                continue;
+
+                            for(std::size_t q = this->lower_inner[this->pivots[j]] + 1; q < this->lower_inner[this->pivots[j] + 1]; ++q)
+                                x[this->lower_outer[q]] -= this->lower_values[q] * x[j];
+                        }
+
+                        // Partial pivoting.
+                        std::size_t pivot = none;
+                        double maximum = -1.0;
+
+                        for(const auto &i: reach) {
+                            if(this->pivots[i] == none) {
+                                if(std::abs(x[i]) > maximum) {
+                                    maximum = std::abs(x[i]);
+                                    pivot = i;
+                                }
+                            } else {
+                                this->upper_outer.emplace_back(this->pivots[i]);
+                                this->upper_values.emplace_back(x[i]);
+                            }
+                        }
+
+                        if((pivot == none) || (maximum <= 0.0)) {
+                            this->regular = false;
+                            return false;
+                        }
+
+                        const T value = x[pivot];
+                        this->pivots[pivot] = k;
+
+                        this->upper_outer.emplace_back(k);
+                        this->upper_values.emplace_back(value);
+                        this->upper_inner.emplace_back(this->upper_outer.size());
+
+                        this->lower_outer.emplace_back(pivot);
+                        this->lower_values.emplace_back(static_cast<T>(1));
+
+                        for(const auto &i: reach) {
+                            if(this->pivots[i] == none) {
+                                this->lower_outer.emplace_back(i);
+                                this->lower_values.emplace_back(x[i] / value);
+                            }
+
+                            x[i] = static_cast<T>(0);
+                        }
+
+                        this->lower_inner.emplace_back(this->lower_outer.size());
+                    }
+
+                    // L's rows in pivoted order.
+                    for(auto &row: this->lower_outer)
+                        row = this->pivots[row];
+
+                    return true;
+                }
+
+                // SOLUTION.
+
+                /**
+                 * @brief Solves A x = b.
+                 *
+                 * @param b
+                 * @param x
+                 */
+                void solve(const std::vector<T> &b, std::vector<T> &x) const {
+                    #ifndef NDEBUG
+                    assert(this->regular);
+                    assert(b.size() == this->pivots.size());
+                    #endif
+
+                    const std::size_t size = b.size();
+                    std::vector<T> y;
+                    y.resize(size);
+
+                    for(std::size_t j = 0; j < size; ++j)
+                        y[this->pivots[j]] = b[j];
+
+                    // Forward, L.
+                    for(std::size_t k = 0; k < size; ++k) {
+                        for(std::size_t q = this->lower_inner[k] + 1; q < this->lower_inner[k + 1]; ++q)
+                            y[this->lower_outer[q]] -= this->lower_values[q] * y[k];
+                    }
+
+                    // Backward, U.
+                    for(std::size_t k = size; k-- > 0;) {
+                        y[k] /= this->upper_values[this->upper_inner[k + 1] - 1];
+
+                        for(std::size_t q = this->upper_inner[k]; q < this->upper_inner[k + 1] - 1; ++q)
+                            y[this->upper_outer[q]] -= this->upper_values[q] * y[k];
+                    }
+
+                    x.resize(size);
+
+                    for(std::size_t k = 0; k < size; ++k)
+                        x[this->ordering[k]] = y[k];
+                }
+
+                /**
+                 * @brief Preconditioner interface, exact solve.
+                 *
+                 * @param residual
+                 * @param result
+                 */
+                void apply(const std::vector<T> &residual, std::vector<T> &result) const {
+                    this->solve(residual, result);
+                }
+
+                /**
+                 * @brief Returns whether the last factorization succeeded.
+                 *
+                 * @return true
+                 * @return false
+                 */
+                inline bool is_regular() const {
+                    return this->regular;
+                }
+
+                /**
+                 * @brief Returns the number of non zero elements of L and U.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t fill() const {
+                    return this->lower_outer.size() + this->upper_outer.size();
+                }
+        };
+
+    }
+
+}
+
+#endif
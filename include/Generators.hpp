@@ -0,0 +1,445 @@
+/**
+ * @file Generators.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-04-30
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef GENERATORS_PACS
+#define GENERATORS_PACS
+
+// Type.
+#include <Type.hpp>
+
+// Matrix.
+#include <Matrix.hpp>
+
+// Thread pool.
+#ifdef PARALLEL_PACS
+#include <Pool.hpp>
+#endif
+
+// Containers.
+#include <vector>
+#include <array>
+
+// Assertions.
+#include <cassert>
+
+// Algorithms.
+#include <algorithm>
+#include <numeric>
+
+// Math.
+#include <cmath>
+
+// Concurrency.
+#include <atomic>
+
+// Integers.
+#include <cstdint>
+
+namespace pacs {
+
+    namespace algebra {
+
+        // RANDOMNESS.
+
+        /**
+         * @brief SplitMix64's finalizer.
+         *
+         * @param value
+         * @return std::uint64_t
+         */
+        inline std::uint64_t mix(std::uint64_t value) {
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+            return value ^ (value >> 31);
+        }
+
+        /**
+         * @brief Returns a uniform double in [0, 1) keyed by a seed and two indices.
+         *
+         * @param seed
+         * @param first
+         * @param second
+         * @return double
+         */
+        inline double uniform(const std::uint64_t &seed, const std::uint64_t &first, const std::uint64_t &second) {
+            return static_cast<double>(mix(mix(mix(seed + 0x9E3779B97F4A7C15) ^ first) ^ second) >> 11) * 0x1.0p-53;
+        }
+
+        /**
+         * @brief Counter-based SplitMix64 stream, one per key, so that generators are deterministic regardless of the number of threads.
+         *
+         */
+        class Stream {
+            private:
+
+                std::uint64_t state;
+
+            public:
+
+                /**
+                 * @brief Stream's constructor.
+                 *
+                 * @param seed
+                 * @param key
+                 */
+                Stream(const std::uint64_t &seed, const std::uint64_t &key): state{mix(mix(seed + 0x9E3779B97F4A7C15) ^ key)} {}
+
+                /**
+                 * @brief Returns the next 64 random bits.
+                 *
+                 * @return std::uint64_t
+                 */
+                inline std::uint64_t next() {
+                    return mix(this->state += 0x9E3779B97F4A7C15);
+                }
+
+                /**
+                 * @brief Returns the next uniform double in [0, 1).
+                 *
+                 * @return double
+                 */
+                inline double uniform() {
+                    return static_cast<double>(this->next() >> 11) * 0x1.0p-53;
+                }
+        };
+
+        /**
+         * @brief Returns a constant-coefficient stencil on a nx by ny by nz grid with Dirichlet boundaries, nodes numbered x first.
+         * Neighbours carry -1 and the centre the stencil's full number of neighbours.
+         *
+         * @tparam T
+         * @tparam O
+         * @param sizes
+         * @param offsets Neighbours' offsets, {dx, dy, dz}, by increasing linear index.
+         * @return Matrix<T, O>
+         */
+        template<MatrixType T, Order O>
+        Matrix<T, O> stencil(const std::array<std::size_t, 3> &sizes, const std::vector<std::array<long, 3>> &offsets) {
+            const std::size_t size = sizes[0] * sizes[1] * sizes[2];
+            const T centre = static_cast<T>(static_cast<double>(offsets.size() - 1));
+
+            // Calls function(k, centre) for every neighbour k of node j.
+            auto visit = [&sizes, &offsets](const std::size_t &j, const auto &function) {
+                const std::array<long, 3> node = {static_cast<long>(j % sizes[0]), static_cast<long>(j / sizes[0] % sizes[1]), static_cast<long>(j / sizes[0] / sizes[1])};
+
+                for(const auto &offset: offsets) {
+                    bool inside = true;
+
+                    for(std::size_t d = 0; d < 3; ++d)
+                        inside = inside && (node[d] + offset[d] >= 0) && (node[d] + offset[d] < static_cast<long>(sizes[d]));
+
+                    if(inside)
+                        function(static_cast<std::size_t>((node[2] + offset[2]) * static_cast<long>(sizes[1] * sizes[0]) + (node[1] + offset[1]) * static_cast<long>(sizes[0]) + node[0] + offset[0]), (offset[0] == 0) && (offset[1] == 0) && (offset[2] == 0));
+                }
+            };
+
+            auto length = [&visit](const std::size_t &j) {
+                std::size_t length = 0;
+                visit(j, [&length](const std::size_t &, const bool &) { ++length; });
+                return length;
+            };
+
+            auto fill = [&visit, &centre](const std::size_t &j, auto outer, auto values) {
+                visit(j, [&outer, &values, &centre](const std::size_t &k, const bool &diagonal) {
+                    *(outer++) = k;
+                    *(values++) = diagonal ? centre : static_cast<T>(-1.0);
+                });
+            };
+
+            return Matrix<T, O>::build(size, size, length, fill);
+        }
+
+        /**
+         * @brief Returns the offsets of the 3 by 3 by 3 neighbourhood within a given Manhattan distance, by increasing linear index.
+         *
+         * @param distance
+         * @param dimensions
+         * @return std::vector<std::array<long, 3>>
+         */
+        inline std::vector<std::array<long, 3>> neighbourhood(const long &distance, const std::size_t &dimensions) {
+            std::vector<std::array<long, 3>> offsets;
+
+            for(long dz = (dimensions > 2 ? -1 : 0); dz <= (dimensions > 2 ? 1 : 0); ++dz)
+                for(long dy = -1; dy <= 1; ++dy)
+                    for(long dx = -1; dx <= 1; ++dx)
+                        if(std::abs(dx) + std::abs(dy) + std::abs(dz) <= distance)
+                            offsets.push_back({dx, dy, dz});
+
+            return offsets;
+        }
+
+        // GENERATORS.
+
+        /**
+         * @brief Returns the 5-point Laplacian on a nx by ny grid.
+         *
+         * @tparam T
+         * @tparam O
+         * @param nx
+         * @param ny
+         * @return Matrix<T, O>
+         */
+        template<MatrixType T, Order O = Row>
+        Matrix<T, O> laplacian5(const std::size_t &nx, const std::size_t &ny = 0) {
+            return stencil<T, O>({nx, ny ? ny : nx, 1}, neighbourhood(1, 2));
+        }
+
+        /**
+         * @brief Returns the 7-point Laplacian on a nx by ny by nz grid.
+         *
+         * @tparam T
+         * @tparam O
+         * @param nx
+         * @param ny
+         * @param nz
+         * @return Matrix<T, O>
+         */
+        template<MatrixType T, Order O = Row>
+        Matrix<T, O> laplacian7(const std::size_t &nx, const std::size_t &ny = 0, const std::size_t &nz = 0) {
+            return stencil<T, O>({nx, ny ? ny : nx, nz ? nz : nx}, neighbourhood(1, 3));
+        }
+
+        /**
+         * @brief Returns the 27-point Laplacian-like operator on a nx by ny by nz grid.
+         *
+         * @tparam T
+         * @tparam O
+         * @param nx
+         * @param ny
+         * @param nz
+         * @return Matrix<T, O>
+         */
+        template<MatrixType T, Order O = Row>
+        Matrix<T, O> laplacian27(const std::size_t &nx, const std::size_t &ny = 0, const std::size_t &nz = 0) {
+            return stencil<T, O>({nx, ny ? ny : nx, nz ? nz : nx}, neighbourhood(3, 3));
+        }
+
+        /**
+         * @brief Returns a banded matrix with given lower and upper bandwidths.
+         * Off-diagonal elements are uniform in (-1, 0], keyed by their unordered indices, and the diagonal is lower + upper + 1, so that equal bandwidths give symmetric positive definite matrices.
+         *
+         * @tparam T
+         * @tparam O
+         * @param size
+         * @param lower
+         * @param upper
+         * @param seed
+         * @return Matrix<T, O>
+         */
+        template<MatrixType T, Order O = Row>
+        Matrix<T, O> banded(const std::size_t &size, const std::size_t &lower, const std::size_t &upper, const std::uint64_t &seed = 0) {
+            // Storage order bandwidths.
+            const std::size_t before = O == Row ? lower : upper;
+            const std::size_t after = O == Row ? upper : lower;
+            const T diagonal = static_cast<T>(static_cast<double>(lower + upper + 1));
+
+            auto length = [&size, &before, &after](const std::size_t &j) {
+                return std::min(j + after + 1, size) - (j > before ? j - before : 0);
+            };
+
+            auto fill = [&size, &before, &after, &diagonal, &seed](const std::size_t &j, auto outer, auto values) {
+                for(std::size_t k = (j > before ? j - before : 0); k < std::min(j + after + 1, size); ++k) {
+                    *(outer++) = k;
+                    *(values++) = (k == j) ? diagonal : static_cast<T>(-uniform(seed, std::min(j, k), std::max(j, k)));
+                }
+            };
+
+            return Matrix<T, O>::build(size, size, length, fill);
+        }
+
+        /**
+         * @brief Returns an Erdős-Rényi G(n, p) random matrix, each element being present with a given probability and uniform in [-1, 1).
+         * Rows are drawn independently by geometric skipping, one stream each, in O(nnz), so that the matrix does not depend on its ordering: Column matrices are transposed from their rows.
+         *
+         * @tparam T
+         * @tparam O
+         * @param rows
+         * @param columns
+         * @param probability
+         * @param seed
+         * @return Matrix<T, O>
+         */
+        template<MatrixType T, Order O = Row>
+        Matrix<T, O> erdos_renyi(const std::size_t &rows, const std::size_t &columns, const double &probability, const std::uint64_t &seed = 0) {
+            #ifndef NDEBUG
+            assert((probability >= 0.0) && (probability <= 1.0));
+            #endif
+
+            if constexpr (O == Column) {
+                const Matrix<T, Row> transposed = erdos_renyi<T, Row>(rows, columns, probability, seed).transpose();
+                return Matrix<T, Column>{columns, rows, transposed.get_inner(), transposed.get_outer(), transposed.get_values()};
+            }
+
+            const double logarithm = std::log1p(-probability);
+
+            // Calls function(k, value) for every element of the j-th row.
+            auto draw = [&columns, &probability, &logarithm, &seed](const std::size_t &j, const auto &function) {
+                if(probability <= 0.0)
+                    return;
+
+                Stream stream{seed, j};
+
+                for(std::size_t k = 0; k < columns; ++k) {
+                    if(probability < 1.0) {
+                        const double skip = std::floor(std::log1p(-stream.uniform()) / logarithm);
+
+                        if(skip >= static_cast<double>(columns - k))
+                            return;
+
+                        k += static_cast<std::size_t>(skip);
+                    }
+
+                    function(k, 2.0 * stream.uniform() - 1.0);
+                }
+            };
+
+            auto length = [&draw](const std::size_t &j) {
+                std::size_t length = 0;
+                draw(j, [&length](const std::size_t &, const double &) { ++length; });
+                return length;
+            };
+
+            auto fill = [&draw](const std::size_t &j, auto outer, auto values) {
+                draw(j, [&outer, &values](const std::size_t &k, const double &value) {
+                    *(outer++) = k;
+                    *(values++) = static_cast<T>(value);
+                });
+            };
+
+            return Matrix<T, O>::build(rows, columns, length, fill);
+        }
+
+        /**
+         * @brief Returns a R-MAT power-law random matrix of size 2^scale, with factor * 2^scale drawn edges and elements uniform in (0, 1].
+         * Each edge descends scale levels choosing a quadrant with probabilities a, b, c and 1 - a - b - c; duplicates are merged.
+         *
+         * @tparam T
+         * @tparam O
+         * @param scale
+         * @param factor Edges per row.
+         * @param seed
+         * @param a
+         * @param b
+         * @param c
+         * @return Matrix<T, O>
+         */
+        template<MatrixType T, Order O = Row>
+        Matrix<T, O> rmat(const std::size_t &scale, const std::size_t &factor = 16, const std::uint64_t &seed = 0, const double &a = 0.57, const double &b = 0.19, const double &c = 0.19) {
+            #ifndef NDEBUG
+            assert((scale > 0) && (scale < 64));
+            assert((a >= 0.0) && (b >= 0.0) && (c >= 0.0) && (a + b + c <= 1.0));
+            #endif
+
+            const std::size_t size = static_cast<std::size_t>(1) << scale;
+            const std::size_t edges = factor * size;
+
+            // Edges, in storage order.
+            std::vector<std::array<std::size_t, 2>> drawn;
+            drawn.resize(edges);
+
+            each(edges, [&seed, &scale, &a, &b, &c, &drawn](const std::size_t &e) {
+                Stream stream{seed, e};
+                std::size_t row = 0, column = 0;
+
+                for(std::size_t level = 0; level < scale; ++level) {
+                    const double u = stream.uniform();
+
+                    row = 2 * row + (u >= a + b);
+                    column = 2 * column + (((u >= a) && (u < a + b)) || (u >= a + b + c));
+                }
+
+                drawn[e] = O == Row ? std::array<std::size_t, 2>{row, column} : std::array<std::size_t, 2>{column, row};
+            });
+
+            // Bucketing by primary index.
+            std::vector<std::atomic<std::size_t>> cursors(size);
+            std::vector<std::size_t> offsets, buckets, lengths;
+            offsets.resize(size + 1, 0);
+            buckets.resize(edges);
+            lengths.resize(size);
+
+            each(edges, [&drawn, &cursors](const std::size_t &e) { cursors[drawn[e][0]].fetch_add(1, std::memory_order_relaxed); });
+
+            for(std::size_t j = 0; j < size; ++j) {
+                offsets[j + 1] = offsets[j] + cursors[j].load(std::memory_order_relaxed);
+                cursors[j].store(offsets[j], std::memory_order_relaxed);
+            }
+
+            each(edges, [&drawn, &cursors, &buckets](const std::size_t &e) { buckets[cursors[drawn[e][0]].fetch_add(1, std::memory_order_relaxed)] = drawn[e][1]; });
+
+            // Sorting and merging, deterministic.
+            each(size, [&offsets, &buckets, &lengths](const std::size_t &j) {
+                std::sort(buckets.begin() + offsets[j], buckets.begin() + offsets[j + 1]);
+                lengths[j] = std::unique(buckets.begin() + offsets[j], buckets.begin() + offsets[j + 1]) - (buckets.begin() + offsets[j]);
+            });
+
+            auto length = [&lengths](const std::size_t &j) {
+                return lengths[j];
+            };
+
+            auto fill = [&offsets, &buckets, &lengths, &seed](const std::size_t &j, auto outer, auto values) {
+                for(std::size_t k = offsets[j]; k < offsets[j] + lengths[j]; ++k) {
+                    *(outer++) = buckets[k];
+                    *(values++) = static_cast<T>(1.0 - (O == Row ? uniform(seed, j, buckets[k]) : uniform(seed, buckets[k], j)));
+                }
+            };
+
+            return Matrix<T, O>::build(size, size, length, fill);
+        }
+
+        /**
+         * @brief Returns a block-structured FEM-like matrix: bilinear elements on a n by n mesh, each node carrying block unknowns and coupling with its 3 by 3 neighbourhood through dense blocks.
+         * Off-diagonal elements are uniform in (-1, 0], keyed by their unordered indices, and the diagonal is 9 * block, so that the matrix is symmetric positive definite.
+         *
+         * @tparam T
+         * @tparam O
+         * @param elements Elements per side.
+         * @param block Unknowns per node.
+         * @param seed
+         * @return Matrix<T, O>
+         */
+        template<MatrixType T, Order O = Row>
+        Matrix<T, O> fem(const std::size_t &elements, const std::size_t &block = 3, const std::uint64_t &seed = 0) {
+            const std::size_t nodes = elements + 1;
+            const std::size_t size = nodes * nodes * block;
+            const T diagonal = static_cast<T>(static_cast<double>(9 * block));
+
+            // Calls function(n) for every neighbouring node n of the j-th unknown's node, by increasing index.
+            auto visit = [&nodes, &block](const std::size_t &j, const auto &function) {
+                const std::size_t node = j / block, x = node % nodes, y = node / nodes;
+
+                for(std::size_t ny = (y > 0 ? y - 1 : 0); ny < std::min(y + 2, nodes); ++ny)
+                    for(std::size_t nx = (x > 0 ? x - 1 : 0); nx < std::min(x + 2, nodes); ++nx)
+                        function(ny * nodes + nx);
+            };
+
+            auto length = [&visit, &block](const std::size_t &j) {
+                std::size_t length = 0;
+                visit(j, [&length, &block](const std::size_t &) { length += block; });
+                return length;
+            };
+
+            auto fill = [&visit, &block, &diagonal, &seed](const std::size_t &j, auto outer, auto values) {
+                visit(j, [&j, &outer, &values, &block, &diagonal, &seed](const std::size_t &node) {
+                    for(std::size_t k = node * block; k < (node + 1) * block; ++k) {
+                        *(outer++) = k;
+                        *(values++) = (k == j) ? diagonal : static_cast<T>(-uniform(seed, std::min(j, k), std::max(j, k)));
+                    }
+                });
+            };
+
+            return Matrix<T, O>::build(size, size, length, fill);
+        }
+
+    }
+
+}
+
+#endif
@@ -99,6 +99,14 @@ namespace pacs {
          */
         template<MatrixType T, Order O = Row>
         void market(const Matrix<T, O> &matrix, const std::string &filename, const bool &verbose = false) {
+            // General storage.
+            if(matrix.is_symmetric()) {
+                Matrix<T, O> expanded = matrix;
+                expanded.expand();
+
+                return market(expanded, filename, verbose);
+            }
+
             // File loading.
             std::ofstream file{filename};
 
@@ -114,25 +122,25 @@ namespace pacs {
 
                 for(const auto &[key, value]: elements) {
                     if constexpr (O == Row)
-                        file << key[0] << " " << key[1] << " " << std::setprecision(12) << std::scientific << value << "\n";
+                        file << key[0] + 1 << " " << key[1] + 1 << " " << std::setprecision(12) << std::scientific << value << "\n";
 
                     if constexpr (O == Column)
-                        file << key[1] << " " << key[0] << " " << std::setprecision(12) << std::scientific << value << "\n";
+                        file << key[1] + 1 << " " << key[0] + 1 << " " << std::setprecision(12) << std::scientific << value << "\n";
                 }
 
             } else {
                 
-                std::vector<size_t> inner = matrix.get_inner();
-                std::vector<size_t> outer = matrix.get_outer();
-                std::vector<T> values = matrix.get_values();
+                const auto &inner = matrix.get_inner();
+                const auto &outer = matrix.get_outer();
+                const auto &values = matrix.get_values();
 
                 for(std::size_t j = 0; j < inner.size() - 1; ++j) {
                     for(std::size_t k = inner[j]; k < inner[j + 1]; ++k) {
                         if constexpr (O == Row)
-                            file << j << " " << outer[k] << " " << std::setprecision(12) << std::scientific << values[k] << "\n";
+                            file << j + 1 << " " << outer[k] + 1 << " " << std::setprecision(12) << std::scientific << values[k] << "\n";
 
                         if constexpr (O == Column)
-                            file << outer[k] << " " << j << " " << std::setprecision(12) << std::scientific << values[k] << "\n";
+                            file << outer[k] + 1 << " " << j + 1 << " " << std::setprecision(12) << std::scientific << values[k] << "\n";
                     }
                 }
 
@@ -18,6 +18,13 @@
 #include <vector>
 #include <array>
 #include <map>
+#include <optional>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+// Synchronization.
+#include <mutex>
 
 // Output.
 #include <iostream>
@@ -27,9 +34,23 @@
 
 // Algorithms.
 #include <algorithm>
-#include <execution>
+#include <numeric>
 #include <ranges>
 
+// Traits.
+#include <type_traits>
+
+// Thread pool.
+#include <Pool.hpp>
+
+// First-touch storage.
+#include <Memory.hpp>
+
+// Instrumentation.
+#ifdef PROFILING_PACS
+#include <Counters.hpp>
+#endif
+
 // Math.
 #include <cmath>
 
@@ -38,10 +59,34 @@
 #define TOLERANCE_PACS 1E-10
 #endif
 
+// Slabs for reproducible reductions.
+#ifndef SLABS_PACS
+#define SLABS_PACS 256
+#endif
+
 namespace pacs {
 
     namespace algebra {
 
+        /**
+         * @brief Norms and rows' non zero elements statistics.
+         *
+         */
+        struct Norms {
+            double one = 0.0;
+            double infinity = 0.0;
+            double frobenius = 0.0;
+
+            // Maximum absolute value.
+            double maximum = 0.0;
+
+            // Non zero elements, overall and per row.
+            std::size_t nonzeros = 0;
+            std::size_t shortest = 0;
+            std::size_t longest = 0;
+            double mean = 0.0;
+        };
+
         /**
          * @brief Sparse matrix class.
          *
@@ -59,13 +104,510 @@ namespace pacs {
                 // Compressed flag.
                 bool compressed = false;
 
-                // COOmap dynamic storage format.
-                mutable std::map<std::array<std::size_t, 2>, T> elements;
+                // Symmetric flag, only secondary >= primary elements are stored.
+                bool symmetric = false;
+
+                // Assembly arena, owned on request and released on compression.
+                std::unique_ptr<std::pmr::monotonic_buffer_resource> arena;
+
+                // COOmap dynamic storage format, allocated from a memory resource.
+                mutable std::pmr::map<std::array<std::size_t, 2>, T> elements;
+
+                // CSR/CSC compressed pattern, shared among copies and detached on structural changes.
+                struct Pattern {
+                    Vector<std::size_t> inner;
+                    Vector<std::size_t> outer;
+                };
+
+                // CSR/CSC compressed storage format, placed by first touch.
+                std::shared_ptr<Pattern> pattern = std::make_shared<Pattern>();
+                Vector<T> values;
+
+                // Cached properties, computed lazily and invalidated on mutation.
+                struct Properties {
+                    std::optional<Norms> norms;
+                    std::optional<std::vector<T>> diagonal;
+                    std::optional<bool> symmetry;
+                    std::optional<std::array<std::size_t, 2>> bandwidth;
+                    std::optional<std::size_t> size;
+                };
+
+                // Fills from concurrent const queries are serialized.
+                mutable Properties properties;
+                mutable std::mutex guard;
+
+                /**
+                 * @brief Drops the cached properties.
+                 *
+                 */
+                inline void invalidate() {
+                    this->properties = Properties{};
+                }
+
+                /**
+                 * @brief Returns a copy of the cached properties.
+                 *
+                 * @return Properties
+                 */
+                Properties cache() const {
+                    std::lock_guard<std::mutex> lock{this->guard};
+                    return this->properties;
+                }
+
+                /**
+                 * @brief Returns a cached property, computing it outside the lock, as computations may query other properties, when missing.
+                 * Concurrent misses compute it more than once, the first result is kept.
+                 *
+                 * @tparam V
+                 * @param property
+                 * @param compute
+                 * @return const V&
+                 */
+                template<typename V>
+                const V &cached(std::optional<V> &property, const auto &compute) const {
+                    {
+                        std::lock_guard<std::mutex> lock{this->guard};
+
+                        if(property)
+                            return *property;
+                    }
+
+                    V value = compute();
+                    std::lock_guard<std::mutex> lock{this->guard};
+
+                    if(!property)
+                        property = std::move(value);
+
+                    return *property;
+                }
+
+                #ifdef PROFILING_PACS
+                /**
+                 * @brief Returns the bytes a full sweep over the stored elements moves.
+                 *
+                 * @return double
+                 */
+                double traffic() const {
+                    if(!(this->compressed))
+                        return static_cast<double>(this->elements.size() * (sizeof(T) + 2 * sizeof(std::size_t)));
+
+                    return static_cast<double>(this->values.size() * (sizeof(T) + sizeof(std::size_t)) + this->pattern->inner.size() * sizeof(std::size_t));
+                }
+                #endif
+
+                // HELPERS.
+
+                /**
+                 * @brief Allocates compressed storage from its offsets, first-touching it in parallel under the product's partition of primary slices.
+                 * fill(j) has to write the j-th slice of outer and values, on the thread which touches it.
+                 *
+                 * @param offsets
+                 * @param inner
+                 * @param outer
+                 * @param values
+                 * @param fill
+                 */
+                static void layout(const auto &offsets, Vector<std::size_t> &inner, Vector<std::size_t> &outer, Vector<T> &values, const auto &fill) {
+                    const std::size_t size = offsets.size() - 1;
+
+                    // Fresh, untouched allocations, under the current pages' policy.
+                    inner = Vector<std::size_t>{};
+                    outer = Vector<std::size_t>{};
+                    values = Vector<T>{};
+
+                    inner.resize(size + 1);
+                    outer.resize(offsets[size]);
+                    values.resize(offsets[size]);
+
+                    each(size, [&inner, &offsets, &fill](const std::size_t &j) {
+                        if(j == 0)
+                            inner[0] = offsets[0];
+
+                        inner[j + 1] = offsets[j + 1];
+                        fill(j);
+                    });
+                }
+
+                /**
+                 * @brief Copies compressed storage, placed by first touch.
+                 *
+                 * @param inner
+                 * @param outer
+                 * @param values
+                 */
+                void place(const auto &inner, const auto &outer, const auto &values) {
+                    this->pattern = std::make_shared<Pattern>();
+
+                    layout(inner, this->pattern->inner, this->pattern->outer, this->values, [this, &inner, &outer, &values](const std::size_t &j) {
+                        std::copy(outer.begin() + inner[j], outer.begin() + inner[j + 1], this->pattern->outer.begin() + inner[j]);
+                        std::copy(values.begin() + inner[j], values.begin() + inner[j + 1], this->values.begin() + inner[j]);
+                    });
+                }
+
+                /**
+                 * @brief Shares a compressed Matrix' pattern, copying its values only, placed by first touch.
+                 *
+                 * @param matrix
+                 */
+                void share(const Matrix &matrix) {
+                    this->pattern = matrix.pattern;
+
+                    this->values = Vector<T>{};
+                    this->values.resize(matrix.values.size());
+
+                    each(this->first, [this, &matrix](const std::size_t &j) {
+                        std::copy(matrix.values.begin() + this->pattern->inner[j], matrix.values.begin() + this->pattern->inner[j + 1], this->values.begin() + this->pattern->inner[j]);
+                    });
+                }
+
+                /**
+                 * @brief Makes the pattern unique, copying it if shared, before an in-place structural change.
+                 *
+                 */
+                void detach() {
+                    if(this->pattern.use_count() > 1)
+                        this->pattern = std::make_shared<Pattern>(*(this->pattern));
+                }
+
+                /**
+                 * @brief Drops the elements. An owned arena is released in one shot: its nodes are abandoned, not freed one by one, when trivially destructible.
+                 *
+                 */
+                void release() {
+                    if(!(this->arena)) {
+                        this->elements.clear();
+                        return;
+                    }
+
+                    // Rebinds the elements to the default resource, the arena owns every node.
+                    if constexpr (!std::is_trivially_destructible_v<T>)
+                        std::destroy_at(&this->elements);
+
+                    std::construct_at(&this->elements, std::pmr::get_default_resource());
+                    this->arena.reset();
+                }
+
+                /**
+                 * @brief Returns the reduction of map(j) for j in [0, size) through combine, in parallel when enabled.
+                 *
+                 * @tparam V
+                 * @param size
+                 * @param identity
+                 * @param map
+                 * @param combine
+                 * @return V
+                 */
+                template<typename V>
+                static V reduced(const std::size_t &size, const V &identity, const auto &map, const auto &combine) {
+                    #ifdef PARALLEL_PACS
+                    return Pool::instance().reduce(size, identity, map, combine);
+                    #else
+                    V result = identity;
+
+                    for(std::size_t j = 0; j < size; ++j)
+                        result = combine(result, map(j));
+
+                    return result;
+                    #endif
+                }
+
+                /**
+                 * @brief Symmetric product, each stored element contributes to its row and, transposed, to its column in one pass.
+                 * Rows are split into blocks balanced by non zero elements; contributions falling past a block's rows go to its private buffer, then get gathered by their owners.
+                 *
+                 * @param vector
+                 * @param result
+                 */
+                void symmetric_product(const std::vector<T> &vector, std::vector<T> &result) const {
+                    const std::size_t size = this->first;
+
+                    #ifdef PARALLEL_PACS
+                    const std::size_t blocks = std::max(static_cast<std::size_t>(1), std::min(Pool::instance().threads(), size));
+                    #else
+                    const std::size_t blocks = 1;
+                    #endif
+
+                    if(blocks == 1) {
+                        std::ranges::fill(result, static_cast<T>(0));
+
+                        for(std::size_t j = 0; j < size; ++j) {
+                            T sum = static_cast<T>(0);
+
+                            for(std::size_t i = this->pattern->inner[j]; i < this->pattern->inner[j + 1]; ++i) {
+                                sum += this->values[i] * vector[this->pattern->outer[i]];
+
+                                if(this->pattern->outer[i] != j)
+                                    result[this->pattern->outer[i]] += this->values[i] * vector[j];
+                            }
+
+                            result[j] += sum;
+                        }
+
+                        return;
+                    }
+
+                    // Blocks' bounds and buffers' offsets.
+                    thread_local std::vector<std::size_t> thread_bounds, thread_offsets;
+                    thread_local std::vector<T> thread_buffer;
+
+                    std::vector<std::size_t> &bounds = thread_bounds, &offsets = thread_offsets;
+                    std::vector<T> &buffer = thread_buffer;
+
+                    bounds.resize(blocks + 1);
+                    offsets.resize(blocks + 1);
+
+                    for(std::size_t b = 0; b < blocks; ++b)
+                        bounds[b] = std::ranges::lower_bound(this->pattern->inner, b * this->values.size() / blocks) - this->pattern->inner.begin();
+
+                    bounds[0] = 0;
+                    bounds[blocks] = size;
+                    offsets[0] = 0;
+
+                    for(std::size_t b = 0; b < blocks; ++b)
+                        offsets[b + 1] = offsets[b] + size - bounds[b + 1];
+
+                    buffer.assign(offsets[blocks], static_cast<T>(0));
+
+                    // Row products and transposed scatter.
+                    auto scatter = [this, &vector, &result, &bounds, &offsets, &buffer](const std::size_t &b) {
+                        const std::size_t start = bounds[b], end = bounds[b + 1];
+                        T *local = buffer.data() + offsets[b];
+
+                        std::fill(result.begin() + start, result.begin() + end, static_cast<T>(0));
+
+                        for(std::size_t j = start; j < end; ++j) {
+                            T sum = static_cast<T>(0);
+
+                            for(std::size_t i = this->pattern->inner[j]; i < this->pattern->inner[j + 1]; ++i) {
+                                const std::size_t k = this->pattern->outer[i];
+                                sum += this->values[i] * vector[k];
+
+                                if(k == j)
+                                    continue;
 
-                // CSR/CSC compressed storage format.
-                std::vector<std::size_t> inner;
-                std::vector<std::size_t> outer;
-                std::vector<T> values;
+                                if(k < end)
+                                    result[k] += this->values[i] * vector[j];
+                                else
+                                    local[k - end] += this->values[i] * vector[j];
+                            }
+
+                            result[j] += sum;
+                        }
+                    };
+
+                    // Gathering of preceding blocks' buffers.
+                    auto gather = [&result, &bounds, &offsets, &buffer](const std::size_t &b) {
+                        for(std::size_t j = bounds[b]; j < bounds[b + 1]; ++j) {
+                            for(std::size_t c = 0; c < b; ++c)
+                                result[j] += buffer[offsets[c] + j - bounds[c + 1]];
+                        }
+                    };
+
+                    each(blocks, scatter);
+                    each(blocks, gather);
+                }
+
+                /**
+                 * @brief Scatters the compressed elements onto their secondary indices, split into one range per thread, each range scanning every primary slice in order.
+                 * Each secondary index receives its contributions in the same order whatever the ranges, as in a serial scatter, without private buffers.
+                 *
+                 * @param scatter Called as scatter(j, i) on the i-th element, of the j-th primary slice, by its secondary index's range.
+                 */
+                void scattered(const auto &scatter) const {
+                    #ifdef PARALLEL_PACS
+                    const std::size_t ranges = std::max(static_cast<std::size_t>(1), std::min(Pool::instance().threads(), this->second));
+                    #else
+                    const std::size_t ranges = 1;
+                    #endif
+
+                    if(ranges == 1) {
+                        for(std::size_t j = 0; j < this->first; ++j) {
+                            for(std::size_t i = this->pattern->inner[j]; i < this->pattern->inner[j + 1]; ++i)
+                                scatter(j, i);
+                        }
+
+                        return;
+                    }
+
+                    each(ranges, [this, &ranges, &scatter](const std::size_t &r) {
+                        const std::size_t lower = r * this->second / ranges, upper = (r + 1) * this->second / ranges;
+                        const auto &outer = this->pattern->outer;
+
+                        for(std::size_t j = 0; j < this->first; ++j) {
+                            std::size_t start = this->pattern->inner[j], end = this->pattern->inner[j + 1];
+
+                            if((start == end) || (outer[start] >= upper) || (outer[end - 1] < lower))
+                                continue;
+
+                            // Elements within the range, secondary indices are sorted.
+                            if(outer[start] < lower)
+                                start = std::lower_bound(outer.begin() + start, outer.begin() + end, lower) - outer.begin();
+
+                            if(outer[end - 1] >= upper)
+                                end = std::lower_bound(outer.begin() + start, outer.begin() + end, upper) - outer.begin();
+
+                            for(std::size_t i = start; i < end; ++i)
+                                scatter(j, i);
+                        }
+                    });
+                }
+
+                /**
+                 * @brief Gustavson's sparse accumulation, the primary direction of driver selects combinations of source's primary slices.
+                 * Given a compressed, general mask, only the products falling within its pattern, or outside it if complemented, are computed.
+                 *
+                 * @param driver
+                 * @param source
+                 * @param first Result's first dimension.
+                 * @param second Result's second dimension.
+                 * @param mask
+                 * @param complement
+                 * @return Matrix
+                 */
+                static Matrix gustavson(const Matrix &driver, const Matrix &source, const std::size_t &first, const std::size_t &second, const Matrix *mask = nullptr, const bool &complement = false) {
+                    #ifdef PROFILING_PACS
+                    double multiplications = 0.0;
+
+                    for(const auto &k: driver.pattern->outer)
+                        multiplications += static_cast<double>(source.pattern->inner[k + 1] - source.pattern->inner[k]);
+
+                    Probe probe{"spgemm", static_cast<double>(driver.values.size() + source.values.size()), 2.0 * multiplications, driver.traffic() + source.traffic()};
+                    #endif
+
+                    std::vector<std::size_t> inner;
+                    inner.resize(first + 1, 0);
+
+                    // Symbolic pass, upper bounds on lengths.
+                    auto count = [&driver, &source, &second, &inner, &mask, &complement](const std::size_t &j) {
+                        thread_local std::vector<std::size_t> marker, allowed;
+                        thread_local std::size_t stamp = 0;
+
+                        if(marker.size() < second)
+                            marker.resize(second, 0);
+
+                        ++stamp;
+                        std::size_t length = 0;
+
+                        // Mask' slice.
+                        if(mask != nullptr) {
+                            if(!complement && (mask->pattern->inner[j] == mask->pattern->inner[j + 1]))
+                                return;
+
+                            if(allowed.size() < second)
+                                allowed.resize(second, 0);
+
+                            for(std::size_t h = mask->pattern->inner[j]; h < mask->pattern->inner[j + 1]; ++h)
+                                allowed[mask->pattern->outer[h]] = stamp;
+                        }
+
+                        for(std::size_t h = driver.pattern->inner[j]; h < driver.pattern->inner[j + 1]; ++h) {
+                            const std::size_t k = driver.pattern->outer[h];
+
+                            for(std::size_t i = source.pattern->inner[k]; i < source.pattern->inner[k + 1]; ++i) {
+                                if((mask != nullptr) && ((allowed[source.pattern->outer[i]] == stamp) == complement))
+                                    continue;
+
+                                if(marker[source.pattern->outer[i]] != stamp) {
+                                    marker[source.pattern->outer[i]] = stamp;
+                                    ++length;
+                                }
+                            }
+                        }
+
+                        inner[j + 1] = length;
+                    };
+
+                    each(first, count);
+                    std::inclusive_scan(inner.begin(), inner.end(), inner.begin());
+
+                    std::vector<std::size_t> outer, kept;
+                    std::vector<T> values;
+                    outer.resize(inner.back());
+                    values.resize(inner.back());
+                    kept.resize(first + 1, 0);
+
+                    // Numeric pass, dense accumulator.
+                    auto multiply = [&](const std::size_t &j) {
+                        thread_local std::vector<std::size_t> marker, allowed;
+                        thread_local std::vector<T> accumulator;
+                        thread_local std::size_t stamp = 0;
+
+                        if(marker.size() < second) {
+                            marker.resize(second, 0);
+                            accumulator.resize(second);
+                        }
+
+                        ++stamp;
+                        std::size_t index = inner[j];
+
+                        if(inner[j] == inner[j + 1])
+                            return;
+
+                        // Mask' slice.
+                        if(mask != nullptr) {
+                            if(allowed.size() < second)
+                                allowed.resize(second, 0);
+
+                            for(std::size_t h = mask->pattern->inner[j]; h < mask->pattern->inner[j + 1]; ++h)
+                                allowed[mask->pattern->outer[h]] = stamp;
+                        }
+
+                        for(std::size_t h = driver.pattern->inner[j]; h < driver.pattern->inner[j + 1]; ++h) {
+                            const std::size_t k = driver.pattern->outer[h];
+
+                            for(std::size_t i = source.pattern->inner[k]; i < source.pattern->inner[k + 1]; ++i) {
+                                const std::size_t c = source.pattern->outer[i];
+
+                                if((mask != nullptr) && ((allowed[c] == stamp) == complement))
+                                    continue;
+
+                                if(marker[c] != stamp) {
+                                    marker[c] = stamp;
+                                    accumulator[c] = driver.values[h] * source.values[i];
+                                    outer[index++] = c;
+                                } else
+                                    accumulator[c] += driver.values[h] * source.values[i];
+                            }
+                        }
+
+                        std::sort(outer.begin() + inner[j], outer.begin() + inner[j + 1]);
+
+                        // Gathering.
+                        index = inner[j];
+
+                        for(std::size_t h = inner[j]; h < inner[j + 1]; ++h) {
+                            if(std::abs(accumulator[outer[h]]) > TOLERANCE_PACS) { // Check needed.
+                                outer[index] = outer[h];
+                                values[index++] = accumulator[outer[h]];
+                            }
+                        }
+
+                        kept[j + 1] = index - inner[j];
+                    };
+
+                    each(first, multiply);
+
+                    // Compaction of dropped elements.
+                    std::inclusive_scan(kept.begin(), kept.end(), kept.begin());
+
+                    if(kept.back() < inner.back()) {
+                        for(std::size_t j = 0; j < first; ++j) {
+                            std::copy(outer.begin() + inner[j], outer.begin() + inner[j] + kept[j + 1] - kept[j], outer.begin() + kept[j]);
+                            std::copy(values.begin() + inner[j], values.begin() + inner[j] + kept[j + 1] - kept[j], values.begin() + kept[j]);
+                        }
+
+                        outer.resize(kept.back());
+                        values.resize(kept.back());
+                    }
+
+                    Matrix result{first, second, kept, outer, values};
+
+                    #ifdef PROFILING_PACS
+                    probe.account(0.0, result.traffic());
+                    #endif
+
+                    return result;
+                }
 
             public:
 
@@ -83,6 +625,20 @@ namespace pacs {
                     #endif
                 }
 
+                /**
+                 * @brief Construct a new empty Matrix whose elements are allocated from a given memory resource, which has to outlive them.
+                 *
+                 * @param first
+                 * @param second
+                 * @param resource
+                 */
+                Matrix(const std::size_t &first, const std::size_t &second, std::pmr::memory_resource *resource): first{first}, second{second}, elements{resource} {
+                    #ifndef NDEBUG // Integrity check.
+                    assert((first > 0) && (second > 0));
+                    assert(resource != nullptr);
+                    #endif
+                }
+
                 /**
                  * @brief Construct a new Matrix from a given std::map.
                  *
@@ -91,7 +647,7 @@ namespace pacs {
                  * @param elements
                  */
                 Matrix(const std::size_t &first, const std::size_t &second, const std::map<std::array<std::size_t, 2>, T> elements):
-                first{first}, second{second}, elements{elements} {
+                first{first}, second{second}, elements{elements.begin(), elements.end()} {
                     #ifndef NDEBUG // Integrity checks.
                     assert((first > 0) && (second > 0));
 
@@ -108,45 +664,80 @@ namespace pacs {
                  * @param second
                  * @param elements
                  */
-                Matrix(const std::size_t &first, const std::size_t &second, const std::vector<std::size_t> &inner, const std::vector<std::size_t> &outer, const std::vector<T> &values):
-                first{first}, second{second}, compressed{true}, inner{inner}, outer{outer}, values{values} {
+                template<std::ranges::random_access_range I, std::ranges::random_access_range J, std::ranges::random_access_range V>
+                Matrix(const std::size_t &first, const std::size_t &second, const I &inner, const J &outer, const V &values):
+                first{first}, second{second}, compressed{true} {
                     #ifndef NDEBUG // Integrity checks.
                     assert((first > 0) && (second > 0));
 
                     assert(inner.size() == first + 1);
-                    for(std::size_t j = 1; j < inner.size(); ++j) {
-                        assert(inner[j - 1] < values.size());
-                        assert(inner[j] < values.size());
+                    assert(inner[first] == values.size());
+                    for(std::size_t j = 1; j < inner.size(); ++j)
                         assert(inner[j - 1] <= inner[j]);
-                    }
 
-                    assert(outer.size() = values.size());
-                    for(std::size_t j = 1; j < outer.size(); ++j) {
-                        assert(outer[j - 1] < second);
-                        assert(outer[j] < second);
-                        assert(outer[j - 1] < outer[j]);
+                    assert(outer.size() == values.size());
+                    for(std::size_t j = 0; j < first; ++j) {
+                        for(std::size_t k = inner[j]; k < inner[j + 1]; ++k) {
+                            assert(outer[k] < second);
+
+                            if(k > inner[j]) // Sorted secondary indices.
+                                assert(outer[k - 1] < outer[k]);
+                        }
                     }
 
                     #endif
+
+                    this->place(inner, outer, values);
+                }
+
+                /**
+                 * @brief Builds a compressed Matrix slice by slice, in parallel and placed by first touch, without intermediate storage.
+                 * length(j) returns the j-th primary slice's number of elements, fill(j, outer, values) writes them, sorted, through the given iterators.
+                 *
+                 * @param first
+                 * @param second
+                 * @param length
+                 * @param fill
+                 * @return Matrix
+                 */
+                static Matrix build(const std::size_t &first, const std::size_t &second, const auto &length, const auto &fill) {
+                    Matrix result{first, second};
+                    result.compressed = true;
+
+                    std::vector<std::size_t> offsets;
+                    offsets.resize(first + 1, 0);
+
+                    each(first, [&offsets, &length](const std::size_t &j) { offsets[j + 1] = length(j); });
+                    std::inclusive_scan(offsets.begin(), offsets.end(), offsets.begin());
+
+                    layout(offsets, result.pattern->inner, result.pattern->outer, result.values, [&result, &offsets, &fill](const std::size_t &j) {
+                        fill(j, result.pattern->outer.begin() + offsets[j], result.values.begin() + offsets[j]);
+                    });
+
+                    #ifndef NDEBUG // Sorted secondary indices.
+                    for(std::size_t j = 0; j < first; ++j) {
+                        for(std::size_t k = offsets[j]; k < offsets[j + 1]; ++k)
+                            assert((result.pattern->outer[k] < second) && ((k == offsets[j]) || (result.pattern->outer[k - 1] < result.pattern->outer[k])));
+                    }
+                    #endif
+
+                    return result;
                 }
 
                 /**
-                 * @brief Copy constructor.
+                 * @brief Copy constructor, compressed copies share their pattern and own their values.
                  *
                  * @param matrix
                  */
-                Matrix(const Matrix &matrix): first{matrix.first}, second{matrix.second}, compressed{matrix.compressed} {
-                    if(!(matrix.compressed)) {
+                Matrix(const Matrix &matrix): first{matrix.first}, second{matrix.second}, compressed{matrix.compressed}, symmetric{matrix.symmetric}, properties{matrix.cache()} {
+                    if(!(matrix.compressed))
                         this->elements = matrix.elements;
-                    } else {
-                        this->inner = matrix.inner;
-                        this->outer = matrix.outer;
-                        this->values = matrix.values;
-                    }
+                    else
+                        this->share(matrix);
                 }
 
                 /**
-                 * @brief Copies an existing matrix.
+                 * @brief Copies an existing matrix, sharing its pattern if compressed.
                  *
                  * @param matrix
                  * @return Matrix&
@@ -156,20 +747,21 @@ namespace pacs {
                     assert((this->first == matrix.first) && (this->second == matrix.second));
                     #endif
 
+                    if(this == &matrix)
+                        return *this;
+
                     this->compressed = matrix.compressed;
+                    this->symmetric = matrix.symmetric;
+                    this->properties = matrix.cache();
 
                     if(!(matrix.compressed)) {
                         this->elements = matrix.elements;
 
-                        this->inner.clear();
-                        this->outer.clear();
+                        this->pattern = std::make_shared<Pattern>();
                         this->values.clear();
                     } else {
                         this->elements.clear();
-
-                        this->inner = matrix.inner;
-                        this->outer = matrix.outer;
-                        this->values = matrix.values;
+                        this->share(matrix);
                     }
 
                     return *this;
@@ -199,9 +791,9 @@ namespace pacs {
                     } else {
 
                         // Either j or outer[k] is always zero.
-                        for(std::size_t j = 0; j < this->inner.size() - 1; ++j) {
-                            for(std::size_t k = this->inner[j]; k < this->inner[j + 1]; ++k)
-                                vector[j + this->outer[k]] = this->values[k];
+                        for(std::size_t j = 0; j < this->pattern->inner.size() - 1; ++j) {
+                            for(std::size_t k = this->pattern->inner[j]; k < this->pattern->inner[j + 1]; ++k)
+                                vector[j + this->pattern->outer[k]] = this->values[k];
                         }
 
                     }
@@ -223,13 +815,17 @@ namespace pacs {
                     assert((j < this->first) && (k < this->second));
                     #endif
 
+                    // Implied elements.
+                    if(this->symmetric && (k < j))
+                        return (*this)(k, j);
+
                     // Checks for the value inside elements, otherwise returns static_cast<T>(0).
                     if(!(this->compressed))
                         return this->elements.contains({j, k}) ? this->elements[{j, k}] : static_cast<T>(0);
 
                     // Looks for the value on compressed Matrix.
-                    for(std::size_t i = this->inner[j]; i < this->inner[j + 1]; ++i) {
-                        if(k == this->outer[i])
+                    for(std::size_t i = this->pattern->inner[j]; i < this->pattern->inner[j + 1]; ++i) {
+                        if(k == this->pattern->outer[i])
                             return this->values[i];
                     }
 
@@ -252,6 +848,12 @@ namespace pacs {
                     assert(!(this->compressed));
                     #endif
 
+                    // Implied elements are stored mirrored.
+                    if(this->symmetric && (k < j))
+                        return this->insert(k, j, element);
+
+                    this->invalidate();
+
                     #ifndef NDEBUG // Separate check not needed.
                     if(std::abs(element) > TOLERANCE_PACS)
                         this->elements[{j, k}] = element;
@@ -272,16 +874,23 @@ namespace pacs {
                     assert(coordinates.size() == elements.size());
                     #endif
 
+                    this->invalidate();
+
                     for(std::size_t j = 0; j < coordinates.size(); ++j) {
+                        std::array<std::size_t, 2> key = coordinates[j];
+
+                        // Implied elements are stored mirrored.
+                        if(this->symmetric && (key[1] < key[0]))
+                            std::swap(key[0], key[1]);
 
                         #ifndef NDEBUG
-                        assert(coordinates[j][0] < this->first);
-                        assert(coordinates[j][1] < this->second);
+                        assert(key[0] < this->first);
+                        assert(key[1] < this->second);
 
                         if(std::abs(elements[j]) > TOLERANCE_PACS)
-                            this->elements[coordinates[j]] = elements[j];
+                            this->elements[key] = elements[j];
                         #else
-                        this->elements[coordinates[j]] = elements[j];
+                        this->elements[key] = elements[j];
                         #endif
 
                     }
@@ -302,14 +911,19 @@ namespace pacs {
                     assert((end[1] - start[1]) * (end[0] - start[0]) == elements.size());
                     #endif
 
+                    this->invalidate();
+
                     for(std::size_t j = start[0]; j < end[0]; ++j) {
                         for(std::size_t k = start[1]; k < end[1]; ++k) {
 
+                            // Implied elements are stored mirrored.
+                            const std::array<std::size_t, 2> key = (this->symmetric && (k < j)) ? std::array<std::size_t, 2>{k, j} : std::array<std::size_t, 2>{j, k};
+
                             #ifndef NDEBUG
                             if(std::abs(elements[j]) > TOLERANCE_PACS)
-                                this->elements[{j, k}] = elements[j * (end[1] - start[1]) + k];
+                                this->elements[key] = elements[j * (end[1] - start[1]) + k];
                             #else
-                            this->elements[{j, k}] = elements[j * (end[1] - start[1]) + k];
+                            this->elements[key] = elements[j * (end[1] - start[1]) + k];
                             #endif
 
                         }
@@ -359,14 +973,171 @@ namespace pacs {
                  * @return Matrix 
                  */
                 Matrix reshape(const std::size_t &first, const std::size_t &second) const {
-                    if(!(this->compressed))
-                        return Matrix{first, second, this->elements};
+                    if(this->symmetric) {
+                        Matrix expanded = *this;
+                        expanded.expand();
 
-                    return Matrix{first, second, this->inner, this->outer, this->values};
+                        return expanded.reshape(first, second);
+                    }
+
+                    if(!(this->compressed))
+                        return Matrix{first, second, this->elements};
+
+                    return Matrix{first, second, this->pattern->inner, this->pattern->outer, this->values};
+                }
+
+                /**
+                 * @brief Returns the transposed matrix, same ordering.
+                 *
+                 * @return Matrix
+                 */
+                Matrix transpose() const {
+                    if(this->symmetric)
+                        return *this;
+
+                    if(!(this->compressed)) {
+                        std::map<std::array<std::size_t, 2>, T> elements;
+
+                        for(const auto &[key, value]: this->elements)
+                            elements[{key[1], key[0]}] = value;
+
+                        return Matrix{this->second, this->first, elements};
+                    }
+
+                    std::vector<std::size_t> inner, outer;
+                    std::vector<T> values;
+                    inner.resize(this->second + 1, 0);
+                    outer.resize(this->values.size());
+                    values.resize(this->values.size());
+
+                    for(const auto &index: this->pattern->outer)
+                        ++inner[index + 1];
+
+                    std::inclusive_scan(inner.begin(), inner.end(), inner.begin());
+
+                    // Scattering, already sorted.
+                    std::vector<std::size_t> position{inner.begin(), inner.end() - 1};
+
+                    for(std::size_t j = 0; j < this->first; ++j) {
+                        for(std::size_t k = this->pattern->inner[j]; k < this->pattern->inner[j + 1]; ++k) {
+                            outer[position[this->pattern->outer[k]]] = j;
+                            values[position[this->pattern->outer[k]]++] = this->values[k];
+                        }
+                    }
+
+                    return Matrix{this->second, this->first, inner, outer, values};
+                }
+
+                /**
+                 * @brief Returns the permuted matrix B(j, k) = A(rows[j], columns[k]), in rows and columns terms regardless of the ordering.
+                 * Compressed matrices are permuted in O(nnz) through two counting sorts.
+                 *
+                 * @param rows Rows' permutation, new to old.
+                 * @param columns Columns' permutation, new to old.
+                 * @return Matrix
+                 */
+                Matrix permute(const std::vector<std::size_t> &rows, const std::vector<std::size_t> &columns) const {
+                    #ifndef NDEBUG
+                    assert((rows.size() == this->rows()) && (columns.size() == this->columns()));
+                    #endif
+
+                    if(this->symmetric) {
+                        Matrix expanded = *this;
+                        expanded.expand();
+
+                        return expanded.permute(rows, columns);
+                    }
+
+                    // Primary and secondary permutations.
+                    const std::vector<std::size_t> &primary = O == Row ? rows : columns;
+                    const std::vector<std::size_t> &secondary = O == Row ? columns : rows;
+
+                    // Inverse permutations.
+                    std::vector<std::size_t> primary_inverse, secondary_inverse;
+                    primary_inverse.resize(this->first);
+                    secondary_inverse.resize(this->second);
+
+                    for(std::size_t j = 0; j < this->first; ++j)
+                        primary_inverse[primary[j]] = j;
+
+                    for(std::size_t j = 0; j < this->second; ++j)
+                        secondary_inverse[secondary[j]] = j;
+
+                    if(!(this->compressed)) {
+                        std::map<std::array<std::size_t, 2>, T> elements;
+
+                        for(const auto &[key, value]: this->elements)
+                            elements[{primary_inverse[key[0]], secondary_inverse[key[1]]}] = value;
+
+                        return Matrix{this->first, this->second, elements};
+                    }
+
+                    // First counting sort, by new secondary index, visiting new primary indices in order.
+                    std::vector<std::size_t> transposed_inner, transposed_outer;
+                    std::vector<T> transposed_values;
+                    transposed_inner.resize(this->second + 1, 0);
+                    transposed_outer.resize(this->values.size());
+                    transposed_values.resize(this->values.size());
+
+                    for(const auto &index: this->pattern->outer)
+                        ++transposed_inner[secondary_inverse[index] + 1];
+
+                    std::inclusive_scan(transposed_inner.begin(), transposed_inner.end(), transposed_inner.begin());
+                    std::vector<std::size_t> position{transposed_inner.begin(), transposed_inner.end() - 1};
+
+                    for(std::size_t j = 0; j < this->first; ++j) {
+                        for(std::size_t k = this->pattern->inner[primary[j]]; k < this->pattern->inner[primary[j] + 1]; ++k) {
+                            const std::size_t h = position[secondary_inverse[this->pattern->outer[k]]]++;
+                            transposed_outer[h] = j;
+                            transposed_values[h] = this->values[k];
+                        }
+                    }
+
+                    // Second counting sort, back to the original ordering.
+                    std::vector<std::size_t> inner, outer;
+                    std::vector<T> values;
+                    inner.resize(this->first + 1, 0);
+                    outer.resize(this->values.size());
+                    values.resize(this->values.size());
+
+                    for(const auto &index: transposed_outer)
+                        ++inner[index + 1];
+
+                    std::inclusive_scan(inner.begin(), inner.end(), inner.begin());
+                    position.assign(inner.begin(), inner.end() - 1);
+
+                    for(std::size_t j = 0; j < this->second; ++j) {
+                        for(std::size_t k = transposed_inner[j]; k < transposed_inner[j + 1]; ++k) {
+                            const std::size_t h = position[transposed_outer[k]]++;
+                            outer[h] = j;
+                            values[h] = transposed_values[k];
+                        }
+                    }
+
+                    return Matrix{this->first, this->second, inner, outer, values};
                 }
 
                 // COMPRESSION.
 
+                /**
+                 * @brief Allocates the following insertions from an owned monotonic arena, released in one shot by compress().
+                 * The matrix has to be empty and uncompressed, otherwise nothing changes.
+                 *
+                 * @param bytes Initial arena's size, a hint.
+                 */
+                void assemble(const std::size_t &bytes = 0) {
+                    if(this->compressed || !(this->elements.empty()))
+                        return;
+
+                    auto arena = bytes > 0 ? std::make_unique<std::pmr::monotonic_buffer_resource>(bytes) : std::make_unique<std::pmr::monotonic_buffer_resource>();
+
+                    // The map leaves its resource before the resource is replaced.
+                    std::destroy_at(&this->elements);
+
+                    this->arena = std::move(arena);
+                    std::construct_at(&this->elements, this->arena.get());
+                }
+
                 /**
                  * @brief Compresses an uncompressed matrix.
                  *
@@ -375,39 +1146,55 @@ namespace pacs {
                     if(this->compressed)
                         return;
 
-                    std::size_t index = 0;
-                    std::array<std::size_t, 2> current{0, 0};
-                    std::array<std::size_t, 2> next{1, 0};
+                    this->invalidate(); // Filtering.
 
-                    this->inner.resize(this->first + 1);
-                    this->inner[0] = index;
+                    #ifdef PROFILING_PACS
+                    Probe probe{"compress", static_cast<double>(this->elements.size()), 0.0, this->traffic() + static_cast<double>(this->elements.size() * (sizeof(T) + sizeof(std::size_t)))};
+                    #endif
 
-                    // Compression.
-                    for(std::size_t j = 1; j < this->first + 1; ++j) {
-                        for(auto it = this->elements.lower_bound(current); (*it).first < (*(this->elements.lower_bound(next))).first; ++it) {
-                            auto [key, value] = (*it);
+                    std::vector<std::size_t> inner;
+                    inner.resize(this->first + 1, 0);
 
-                            #ifndef NDEBUG
-                            if(std::abs(value) > TOLERANCE_PACS) {
-                                this->outer.emplace_back(key[1]);
-                                this->values.emplace_back(value);
-                                ++index;
-                            }
-                            #else
-                            this->outer.emplace_back(key[1]);
-                            this->values.emplace_back(value);
-                            ++index;
-                            #endif
+                    for(const auto &[key, value]: this->elements) {
 
+                        #ifndef NDEBUG
+                        if(std::abs(value) > TOLERANCE_PACS)
+                            ++inner[key[0] + 1];
+                        #else
+                        ++inner[key[0] + 1];
+                        #endif
+
+                    }
+
+                    std::inclusive_scan(inner.begin(), inner.end(), inner.begin());
+
+                    // Placement.
+                    this->pattern = std::make_shared<Pattern>();
+
+                    layout(inner, this->pattern->inner, this->pattern->outer, this->values, [this, &inner](const std::size_t &j) {
+                        std::fill(this->pattern->outer.begin() + inner[j], this->pattern->outer.begin() + inner[j + 1], 0);
+                        std::fill(this->values.begin() + inner[j], this->values.begin() + inner[j + 1], static_cast<T>(0));
+                    });
+
+                    // Compression, elements are already sorted by (j, k).
+                    std::size_t index = 0;
+
+                    for(const auto &[key, value]: this->elements) {
+
+                        #ifndef NDEBUG
+                        if(std::abs(value) > TOLERANCE_PACS) {
+                            this->pattern->outer[index] = key[1];
+                            this->values[index++] = value;
                         }
+                        #else
+                        this->pattern->outer[index] = key[1];
+                        this->values[index++] = value;
+                        #endif
 
-                        this->inner[j] = index;
-                        ++current[0];
-                        ++next[0];
                     }
 
                     this->compressed = true;
-                    this->elements.clear();
+                    this->release();
                 }
 
                 /**
@@ -418,23 +1205,24 @@ namespace pacs {
                     if(!(this->compressed))
                         return;
 
+                    this->invalidate();
+
                     // Uncompression.
-                    for(std::size_t j = 0; j < this->inner.size() - 1; ++j) {
-                        for(std::size_t k = this->inner[j]; k < this->inner[j + 1]; ++k) {
+                    for(std::size_t j = 0; j < this->pattern->inner.size() - 1; ++j) {
+                        for(std::size_t k = this->pattern->inner[j]; k < this->pattern->inner[j + 1]; ++k) {
 
                             #ifndef NDEBUG
                             if(std::abs(this->values[k]) > TOLERANCE_PACS)
-                                this->elements[{j, this->outer[k]}] = this->values[k];
+                                this->elements[{j, this->pattern->outer[k]}] = this->values[k];
                             #else
-                            this->elements[{j, this->outer[k]}] = this->values[k];
+                            this->elements[{j, this->pattern->outer[k]}] = this->values[k];
                             #endif
 
                         }
                     }
 
                     this->compressed = false;
-                    this->inner.clear();
-                    this->outer.clear();
+                    this->pattern = std::make_shared<Pattern>();
                     this->values.clear();
                 }
 
@@ -448,6 +1236,162 @@ namespace pacs {
                     return this->compressed;
                 }
 
+                // PATTERN.
+
+                /**
+                 * @brief Returns whether two compressed matrices share their pattern.
+                 *
+                 * @param matrix
+                 * @return true
+                 * @return false
+                 */
+                inline bool shares(const Matrix &matrix) const {
+                    return this->compressed && matrix.compressed && (this->pattern == matrix.pattern);
+                }
+
+                /**
+                 * @brief Shares a compressed Matrix' pattern if equal to its own, dropping its copy.
+                 *
+                 * @param matrix
+                 * @return true
+                 * @return false
+                 */
+                bool adopt(const Matrix &matrix) {
+                    if(!(this->compressed) || !(matrix.compressed) || (this->first != matrix.first) || (this->second != matrix.second) || (this->symmetric != matrix.symmetric))
+                        return false;
+
+                    if(this->pattern == matrix.pattern)
+                        return true;
+
+                    if(!std::ranges::equal(this->pattern->inner, matrix.pattern->inner) || !std::ranges::equal(this->pattern->outer, matrix.pattern->outer))
+                        return false;
+
+                    this->pattern = matrix.pattern; // Properties are unchanged.
+                    return true;
+                }
+
+                // SYMMETRY.
+
+                /**
+                 * @brief Switches a square, symmetric matrix to symmetric storage, dropping the elements below the diagonal (in storage order).
+                 * Row matrices keep their upper triangle, Column matrices their lower one, sharing the same inner, outer and values.
+                 *
+                 */
+                void symmetrize() {
+                    #ifndef NDEBUG
+                    assert(this->first == this->second);
+                    #endif
+
+                    if(this->symmetric)
+                        return;
+
+                    this->invalidate();
+                    this->symmetric = true;
+
+                    if(!(this->compressed)) {
+                        std::erase_if(this->elements, [](const auto &element) { return element.first[1] < element.first[0]; });
+                        return;
+                    }
+
+                    // In-place compaction.
+                    this->detach();
+                    std::size_t index = 0;
+
+                    for(std::size_t j = 0; j < this->first; ++j) {
+                        const std::size_t start = this->pattern->inner[j];
+                        this->pattern->inner[j] = index;
+
+                        for(std::size_t k = start; k < this->pattern->inner[j + 1]; ++k) {
+                            if(this->pattern->outer[k] >= j) {
+                                this->pattern->outer[index] = this->pattern->outer[k];
+                                this->values[index++] = this->values[k];
+                            }
+                        }
+                    }
+
+                    this->pattern->inner[this->first] = index;
+                    this->pattern->outer.resize(index);
+                    this->values.resize(index);
+                }
+
+                /**
+                 * @brief Restores the general storage of a symmetric matrix.
+                 *
+                 */
+                void expand() {
+                    if(!(this->symmetric))
+                        return;
+
+                    this->symmetric = false; // Properties are unchanged.
+
+                    if(!(this->compressed)) {
+                        std::pmr::map<std::array<std::size_t, 2>, T> mirrored{this->elements.get_allocator()};
+
+                        for(const auto &[key, value]: this->elements) {
+                            if(key[0] != key[1])
+                                mirrored[{key[1], key[0]}] = value;
+                        }
+
+                        this->elements.merge(mirrored);
+                        return;
+                    }
+
+                    // Mirrored elements precede the stored ones in each row (column).
+                    std::vector<std::size_t> mirrored, inner, position;
+                    mirrored.resize(this->first, 0);
+                    inner.resize(this->first + 1, 0);
+
+                    for(std::size_t j = 0; j < this->first; ++j) {
+                        for(std::size_t k = this->pattern->inner[j]; k < this->pattern->inner[j + 1]; ++k) {
+                            if(this->pattern->outer[k] != j)
+                                ++mirrored[this->pattern->outer[k]];
+                        }
+                    }
+
+                    for(std::size_t j = 0; j < this->first; ++j)
+                        inner[j + 1] = inner[j] + mirrored[j] + this->pattern->inner[j + 1] - this->pattern->inner[j];
+
+                    // Placement.
+                    Vector<std::size_t> placed, outer;
+                    Vector<T> values;
+
+                    layout(inner, placed, outer, values, [&inner, &outer, &values](const std::size_t &j) {
+                        std::fill(outer.begin() + inner[j], outer.begin() + inner[j + 1], 0);
+                        std::fill(values.begin() + inner[j], values.begin() + inner[j + 1], static_cast<T>(0));
+                    });
+
+                    position.assign(inner.begin(), inner.end() - 1);
+
+                    for(std::size_t j = 0; j < this->first; ++j) {
+                        const std::size_t start = inner[j] + mirrored[j];
+
+                        for(std::size_t k = this->pattern->inner[j]; k < this->pattern->inner[j + 1]; ++k) {
+                            outer[start + k - this->pattern->inner[j]] = this->pattern->outer[k];
+                            values[start + k - this->pattern->inner[j]] = this->values[k];
+
+                            if(this->pattern->outer[k] != j) {
+                                outer[position[this->pattern->outer[k]]] = j;
+                                values[position[this->pattern->outer[k]]++] = this->values[k];
+                            }
+                        }
+                    }
+
+                    this->pattern = std::make_shared<Pattern>();
+                    this->pattern->inner.swap(placed);
+                    this->pattern->outer.swap(outer);
+                    this->values.swap(values);
+                }
+
+                /**
+                 * @brief Returns the symmetric state.
+                 *
+                 * @return true
+                 * @return false
+                 */
+                inline bool is_symmetric() const {
+                    return this->symmetric;
+                }
+
                 // OPERATIONS.
 
                 /**
@@ -457,23 +1401,14 @@ namespace pacs {
                  * @return Matrix 
                  */
                 Matrix operator *(const T &scalar) const {
-                    #ifdef PARALLEL_PACS
-                    auto product = [scalar](T element) { return element *= scalar; };
-                    #endif
-
                     Matrix result = *this;
+                    result.invalidate();
 
                     if(!(result.compressed)) {
                         for(const auto &[key, value]: result.elements) // Extremely slow.
                             result.elements[key] *= scalar;
                     } else {
-                        
-                        #ifdef PARALLEL_PACS // Actually faster.
-                        std::transform(std::execution::par, result.values.begin(), result.values.end(), result.values.begin(), product);
-                        #else
-                        for(auto &value: result.values)
-                            value *= scalar;
-                        #endif
+                        each(result.values.size(), [&result, &scalar](const std::size_t &j) { result.values[j] *= scalar; });
                     }
 
                     return result;
@@ -486,22 +1421,13 @@ namespace pacs {
                  * @return Matrix& 
                  */
                 Matrix &operator *=(const T &scalar) {
-                    #ifdef PARALLEL_PACS
-                    auto product = [scalar](T element) { return element *= scalar; };
-                    #endif
+                    this->invalidate();
 
                     if(!(this->compressed)) {
                         for(const auto &[key, value]: this->elements) // Extremely slow.
                             this->elements[key] *= scalar;
                     } else {
-                        
-                        #ifdef PARALLEL_PACS // Actually faster.
-                        std::transform(std::execution::par, this->values.begin(), this->values.end(), this->values.begin(), product);
-                        #else
-                        for(auto &value: this->values)
-                            value *= scalar;
-                        #endif
-
+                        each(this->values.size(), [this, &scalar](const std::size_t &j) { this->values[j] *= scalar; });
                     }
 
                     return *this;
@@ -514,24 +1440,14 @@ namespace pacs {
                  * @return Matrix 
                  */
                 Matrix operator /(const T &scalar) const {
-                    #ifdef PARALLEL_PACS
-                    auto division = [scalar](T element) { return element /= scalar; };
-                    #endif
-
                     Matrix result = *this;
+                    result.invalidate();
 
                     if(!(result.compressed)) {
                         for(const auto &[key, value]: result.elements) // Extremely slow.
                             result.elements[key] /= scalar;
                     } else {
-                        
-                        #ifdef PARALLEL_PACS // Actually faster.
-                        std::transform(std::execution::par, result.values.begin(), result.values.end(), result.values.begin(), division);
-                        #else
-                        for(auto &value: result.values)
-                            value /= scalar;
-                        #endif
-
+                        each(result.values.size(), [&result, &scalar](const std::size_t &j) { result.values[j] /= scalar; });
                     }
 
                     return result;
@@ -544,22 +1460,13 @@ namespace pacs {
                  * @return Matrix& 
                  */
                 Matrix &operator /=(const T &scalar) {
-                    #ifdef PARALLEL_PACS
-                    auto division = [scalar](T element) { return element *= scalar; };
-                    #endif
+                    this->invalidate();
 
                     if(!(this->compressed)) {
                         for(const auto &[key, value]: this->elements) // Extremely slow.
                             this->elements[key] /= scalar;
                     } else {
-                        
-                        #ifdef PARALLEL_PACS // Actually faster.
-                        std::transform(std::execution::par, this->values.begin(), this->values.end(), this->values.begin(), division);
-                        #else
-                        for(auto &value: this->values)
-                            value /= scalar;
-                        #endif
-
+                        each(this->values.size(), [this, &scalar](const std::size_t &j) { this->values[j] /= scalar; });
                     }
 
                     return *this;
@@ -576,6 +1483,261 @@ namespace pacs {
                     return matrix * scalar;
                 }
 
+                /**
+                 * @brief Returns the linear combination alpha * first + beta * second.
+                 * The result's pattern is the union of the operands' patterns.
+                 *
+                 * @param alpha
+                 * @param first
+                 * @param beta
+                 * @param second
+                 * @return Matrix
+                 */
+                friend Matrix axpby(const T &alpha, const Matrix &first, const T &beta, const Matrix &second) {
+                    #ifndef NDEBUG
+                    assert((first.first == second.first) && (first.second == second.second));
+                    #endif
+
+                    // Mixed storage, expands the symmetric operand.
+                    if(first.symmetric != second.symmetric) {
+                        Matrix expanded = first.symmetric ? first : second;
+                        expanded.expand();
+
+                        return first.symmetric ? axpby(alpha, expanded, beta, second) : axpby(alpha, first, beta, expanded);
+                    }
+
+                    if(!(first.compressed) || !(second.compressed)) { // Slower.
+                        std::map<std::array<std::size_t, 2>, T> elements;
+
+                        // Accumulation of both operands.
+                        for(const auto &[matrix, scalar]: {std::pair<const Matrix *, T>{&first, alpha}, std::pair<const Matrix *, T>{&second, beta}}) {
+
+                            if(!(matrix->compressed)) {
+                                for(const auto &[key, value]: matrix->elements)
+                                    elements[key] += scalar * value;
+                            } else {
+                                for(std::size_t j = 0; j < matrix->first; ++j) {
+                                    for(std::size_t k = matrix->pattern->inner[j]; k < matrix->pattern->inner[j + 1]; ++k)
+                                        elements[{j, matrix->pattern->outer[k]}] += scalar * matrix->values[k];
+                                }
+                            }
+                        }
+
+                        Matrix result{first.first, first.second, elements};
+                        result.symmetric = first.symmetric;
+
+                        return result;
+                    }
+
+                    // Shared pattern, values only, explicit zeros kept.
+                    if(first.pattern == second.pattern) {
+                        Matrix result = first;
+                        result.invalidate();
+
+                        each(result.values.size(), [&result, &alpha, &first, &beta, &second](const std::size_t &j) { result.values[j] = alpha * first.values[j] + beta * second.values[j]; });
+
+                        return result;
+                    }
+
+                    // Sorted merge of compressed rows (columns).
+                    std::vector<std::size_t> inner;
+                    inner.resize(first.first + 1, 0);
+
+                    // Symbolic pass, merged lengths.
+                    auto count = [&first, &second, &inner](const std::size_t &j) {
+                        std::size_t h = first.pattern->inner[j], k = second.pattern->inner[j], length = 0;
+
+                        while((h < first.pattern->inner[j + 1]) && (k < second.pattern->inner[j + 1])) {
+                            if(first.pattern->outer[h] <= second.pattern->outer[k])
+                                k += (first.pattern->outer[h++] == second.pattern->outer[k]);
+                            else
+                                ++k;
+
+                            ++length;
+                        }
+
+                        inner[j + 1] = length + (first.pattern->inner[j + 1] - h) + (second.pattern->inner[j + 1] - k);
+                    };
+
+                    each(first.first, count);
+                    std::inclusive_scan(inner.begin(), inner.end(), inner.begin());
+
+                    std::vector<std::size_t> outer;
+                    std::vector<T> values;
+                    outer.resize(inner.back());
+                    values.resize(inner.back());
+
+                    // Numeric pass, merged entries.
+                    auto merge = [&](const std::size_t &j) {
+                        std::size_t h = first.pattern->inner[j], k = second.pattern->inner[j], index = inner[j];
+
+                        while((h < first.pattern->inner[j + 1]) && (k < second.pattern->inner[j + 1])) {
+                            if(first.pattern->outer[h] < second.pattern->outer[k]) {
+                                outer[index] = first.pattern->outer[h];
+                                values[index++] = alpha * first.values[h++];
+                            } else if(second.pattern->outer[k] < first.pattern->outer[h]) {
+                                outer[index] = second.pattern->outer[k];
+                                values[index++] = beta * second.values[k++];
+                            } else {
+                                outer[index] = first.pattern->outer[h];
+                                values[index++] = alpha * first.values[h++] + beta * second.values[k++];
+                            }
+                        }
+
+                        for(; h < first.pattern->inner[j + 1]; ++h) {
+                            outer[index] = first.pattern->outer[h];
+                            values[index++] = alpha * first.values[h];
+                        }
+
+                        for(; k < second.pattern->inner[j + 1]; ++k) {
+                            outer[index] = second.pattern->outer[k];
+                            values[index++] = beta * second.values[k];
+                        }
+                    };
+
+                    each(first.first, merge);
+
+                    Matrix result{first.first, first.second, inner, outer, values};
+                    result.symmetric = first.symmetric;
+
+                    return result;
+                }
+
+                /**
+                 * @brief Returns the sum of Matrix + Matrix.
+                 *
+                 * @param matrix
+                 * @return Matrix
+                 */
+                Matrix operator +(const Matrix &matrix) const {
+                    return axpby(static_cast<T>(1), *this, static_cast<T>(1), matrix);
+                }
+
+                /**
+                 * @brief Returns the difference of Matrix - Matrix.
+                 *
+                 * @param matrix
+                 * @return Matrix
+                 */
+                Matrix operator -(const Matrix &matrix) const {
+                    return axpby(static_cast<T>(1), *this, static_cast<T>(-1), matrix);
+                }
+
+                /**
+                 * @brief In-place this += alpha * matrix.
+                 * Compressed matrices are updated in place when matrix' pattern is a subset of this' pattern, otherwise they get merged.
+                 *
+                 * @param alpha
+                 * @param matrix
+                 * @return Matrix&
+                 */
+                Matrix &axpy(const T &alpha, const Matrix &matrix) {
+                    #ifndef NDEBUG
+                    assert((this->first == matrix.first) && (this->second == matrix.second));
+                    #endif
+
+                    // Mixed storage, expands the symmetric operand.
+                    if(this->symmetric != matrix.symmetric) {
+                        if(this->symmetric) {
+                            this->expand();
+                            return this->axpy(alpha, matrix);
+                        }
+
+                        Matrix expanded = matrix;
+                        expanded.expand();
+
+                        return this->axpy(alpha, expanded);
+                    }
+
+                    this->invalidate();
+
+                    if(!(this->compressed)) { // Slower.
+                        if(!(matrix.compressed)) {
+                            for(const auto &[key, value]: matrix.elements)
+                                this->elements[key] += alpha * value;
+                        } else {
+                            for(std::size_t j = 0; j < matrix.first; ++j) {
+                                for(std::size_t k = matrix.pattern->inner[j]; k < matrix.pattern->inner[j + 1]; ++k)
+                                    this->elements[{j, matrix.pattern->outer[k]}] += alpha * matrix.values[k];
+                            }
+                        }
+
+                        return *this;
+                    }
+
+                    if(!(matrix.compressed)) {
+                        Matrix compressed = matrix;
+                        compressed.compress();
+
+                        return this->axpy(alpha, compressed);
+                    }
+
+                    // Shared pattern, values only.
+                    if(this->pattern == matrix.pattern) {
+                        each(this->values.size(), [this, &alpha, &matrix](const std::size_t &j) { this->values[j] += alpha * matrix.values[j]; });
+                        return *this;
+                    }
+
+                    // Pattern inclusion check.
+                    std::vector<unsigned char> included;
+                    included.resize(this->first, 1);
+
+                    auto check = [this, &matrix, &included](const std::size_t &j) {
+                        std::size_t h = this->pattern->inner[j];
+
+                        for(std::size_t k = matrix.pattern->inner[j]; k < matrix.pattern->inner[j + 1]; ++k) {
+                            while((h < this->pattern->inner[j + 1]) && (this->pattern->outer[h] < matrix.pattern->outer[k]))
+                                ++h;
+
+                            if((h == this->pattern->inner[j + 1]) || (this->pattern->outer[h] != matrix.pattern->outer[k])) {
+                                included[j] = 0;
+                                return;
+                            }
+                        }
+                    };
+
+                    each(this->first, check);
+
+                    if(std::ranges::find(included, 0) != included.end())
+                        return *this = axpby(static_cast<T>(1), *this, alpha, matrix);
+
+                    // In-place update.
+                    auto update = [this, &alpha, &matrix](const std::size_t &j) {
+                        std::size_t h = this->pattern->inner[j];
+
+                        for(std::size_t k = matrix.pattern->inner[j]; k < matrix.pattern->inner[j + 1]; ++k) {
+                            while(this->pattern->outer[h] < matrix.pattern->outer[k])
+                                ++h;
+
+                            this->values[h] += alpha * matrix.values[k];
+                        }
+                    };
+
+                    each(this->first, update);
+
+                    return *this;
+                }
+
+                /**
+                 * @brief Returns the sum and assignment of Matrix += Matrix.
+                 *
+                 * @param matrix
+                 * @return Matrix&
+                 */
+                Matrix &operator +=(const Matrix &matrix) {
+                    return this->axpy(static_cast<T>(1), matrix);
+                }
+
+                /**
+                 * @brief Returns the difference and assignment of Matrix -= Matrix.
+                 *
+                 * @param matrix
+                 * @return Matrix&
+                 */
+                Matrix &operator -=(const Matrix &matrix) {
+                    return this->axpy(static_cast<T>(-1), matrix);
+                }
+
                 /**
                  * @brief Returns the product of Matrix x Vector.
                  *
@@ -583,16 +1745,51 @@ namespace pacs {
                  * @return std::vector<T>
                  */
                 std::vector<T> operator *(const std::vector<T> &vector) const {
+                    std::vector<T> result;
+                    this->product(vector, result);
+
+                    return result;
+                }
+
+                /**
+                 * @brief Writes the product of Matrix x Vector into result, reusing its storage.
+                 *
+                 * @param vector
+                 * @param result
+                 */
+                void product(const std::vector<T> &vector, std::vector<T> &result) const {
                     #ifndef NDEBUG // Vector size check.
                     assert(vector.size() == this->columns());
+                    assert(&vector != &result);
                     #endif
 
-                    std::vector<T> result;
-                    result.resize(this->rows(), static_cast<T>(0));
+                    #ifdef PROFILING_PACS
+                    Probe probe{"spmv", static_cast<double>(this->size()), 2.0 * static_cast<double>(this->size()), this->traffic() + static_cast<double>((this->rows() + this->columns()) * sizeof(T))};
+                    #endif
+
+                    result.resize(this->rows());
+
+                    // Symmetric product, same for both orderings.
+                    if(this->symmetric) {
+                        if(!(this->compressed)) { // Slower.
+                            std::ranges::fill(result, static_cast<T>(0));
+
+                            for(const auto &[key, value]: this->elements) {
+                                result[key[0]] += value * vector[key[1]];
+
+                                if(key[0] != key[1])
+                                    result[key[1]] += value * vector[key[0]];
+                            }
+                        } else
+                            this->symmetric_product(vector, result);
+
+                        return;
+                    }
 
                     // Standard Row x Column product.
                     if constexpr (O == Row) {
                         if(!(this->compressed)) { // Slower.
+                            std::ranges::fill(result, static_cast<T>(0));
 
                             // Full iteration on non-zero elements.
                             for(const auto &[key, value]: this->elements)
@@ -600,15 +1797,21 @@ namespace pacs {
 
                         } else { // Faster.
 
-                            // Standard product.
-                            for(std::size_t j = 0; j < result.size(); ++j) {
-                                for(std::size_t i = this->inner[j]; i < this->inner[j + 1]; ++i)
-                                    result[j] += this->values[i] * vector[this->outer[i]];
-                            }
+                            // Standard product, rows in parallel.
+                            each(this->first, [this, &vector, &result](const std::size_t &j) {
+                                T sum = static_cast<T>(0);
+
+                                for(std::size_t i = this->pattern->inner[j]; i < this->pattern->inner[j + 1]; ++i)
+                                    sum += this->values[i] * vector[this->pattern->outer[i]];
+
+                                result[j] = sum;
+                            });
                         }
                     }
 
                     if constexpr (O == Column) {
+                        std::ranges::fill(result, static_cast<T>(0));
+
                         if(!(this->compressed)) { // Slower.
 
                             // Full iteration on non-zero elements.
@@ -617,15 +1820,12 @@ namespace pacs {
 
                         } else { // Faster.
 
-                            // Linear combination of columns.
-                            for(std::size_t j = 0; j < result.size(); ++j) {
-                                for(std::size_t i = this->inner[j]; i < this->inner[j + 1]; ++i)
-                                    result[this->outer[i]] += this->values[i] * vector[j];
-                            }
+                            // Linear combination of columns, rows in parallel.
+                            this->scattered([this, &vector, &result](const std::size_t &j, const std::size_t &i) {
+                                result[this->pattern->outer[i]] += this->values[i] * vector[j];
+                            });
                         }
                     }
-
-                    return result;
                 }
 
                 /**
@@ -640,6 +1840,13 @@ namespace pacs {
                     assert(vector.size() == matrix.rows());
                     #endif
 
+                    if(matrix.symmetric)
+                        return matrix * vector;
+
+                    #ifdef PROFILING_PACS
+                    Probe probe{"spmv_transposed", static_cast<double>(matrix.size()), 2.0 * static_cast<double>(matrix.size()), matrix.traffic() + static_cast<double>((matrix.rows() + matrix.columns()) * sizeof(T))};
+                    #endif
+
                     std::vector<T> result;
                     result.resize(matrix.columns(), static_cast<T>(0));
 
@@ -653,11 +1860,11 @@ namespace pacs {
 
                         } else { // Faster.
 
-                            // Standard product.
-                            for(std::size_t j = 0; j < result.size(); ++j) {
-                                for(std::size_t i = matrix.inner[j]; i < matrix.inner[j + 1]; ++i)
-                                    result[j] += vector[matrix.outer[i]] * matrix.values[i];
-                            }
+                            // Standard product, columns in parallel.
+                            each(result.size(), [&matrix, &vector, &result](const std::size_t &j) {
+                                for(std::size_t i = matrix.pattern->inner[j]; i < matrix.pattern->inner[j + 1]; ++i)
+                                    result[j] += vector[matrix.pattern->outer[i]] * matrix.values[i];
+                            });
                         }
                     }
 
@@ -670,11 +1877,10 @@ namespace pacs {
 
                         } else { // Faster.
 
-                            // Linear combination of rows.
-                            for(std::size_t j = 0; j < result.size(); ++j) {
-                                for(std::size_t i = matrix.inner[j]; i < matrix.inner[j + 1]; ++i)
-                                    result[matrix.outer[i]] += vector[j] * matrix.values[i];
-                            }
+                            // Linear combination of rows, columns in parallel.
+                            matrix.scattered([&matrix, &vector, &result](const std::size_t &j, const std::size_t &i) {
+                                result[matrix.pattern->outer[i]] += vector[j] * matrix.values[i];
+                            });
                         }
                     }
 
@@ -692,70 +1898,55 @@ namespace pacs {
                     assert(this->columns() == matrix.rows());
                     #endif
 
+                    // General storage.
+                    if(this->symmetric || matrix.symmetric) {
+                        Matrix first = *this, second = matrix;
+                        first.expand();
+                        second.expand();
+
+                        return first * second;
+                    }
+
+                    // Sparse accumulation.
+                    if(this->compressed && matrix.compressed) {
+                        if constexpr (O == Row)
+                            return gustavson(*this, matrix, this->first, matrix.second);
+                        else
+                            return gustavson(matrix, *this, matrix.first, this->second);
+                    }
+
                     // Result.
                     std::map<std::array<std::size_t, 2>, T> elements;
 
                     if constexpr (O == Row) {
 
                         if(this->compressed) {
-                            if(matrix.compressed) {
-
-                                // Iteration through this' rows.
-                                for(std::size_t j = 0; j < this->rows(); ++j) { // j-th row of this.
-
-                                    // Row extraction from this.
-                                    std::vector<T> row;
-                                    row.resize(this->columns(), static_cast<T>(0));
-
-                                    for(std::size_t h = this->inner[j]; h < this->inner[j + 1]; ++h)
-                                        row[this->outer[h]] = this->values[h];
-
-                                    // Result's row.
-                                    std::vector<T> product;
-                                    product.resize(matrix.columns(), static_cast<T>(0));
-
-                                    // Linear combination of matrix' rows.
-                                    for(std::size_t k = 0; k < matrix.rows(); ++k) { // k-th row of matrix.
-                                        for(std::size_t h = matrix.inner[k]; h < matrix.inner[k + 1]; ++h) {
-                                            product[matrix.outer[h]] += row[k] * matrix.values[h];
-                                        }
-                                    }
-
-                                    // Updates elements.
-                                    for(std::size_t h = 0; h < product.size(); ++h) {
-                                        if(std::abs(product[h]) > TOLERANCE_PACS) // Check needed.
-                                            elements[{j, h}] = product[h];
-                                    }
-                                }
-
-                            } else {
 
-                                // Iteration through this' rows.
-                                for(std::size_t j = 0; j < this->rows(); ++j) { // j-th row of this.
+                            // Iteration through this' rows.
+                            for(std::size_t j = 0; j < this->rows(); ++j) { // j-th row of this.
 
-                                    // Row extraction from this.
-                                    std::vector<T> row;
-                                    row.resize(this->columns(), static_cast<T>(0));
+                                // Row extraction from this.
+                                std::vector<T> row;
+                                row.resize(this->columns(), static_cast<T>(0));
 
-                                    for(std::size_t h = this->inner[j]; h < this->inner[j + 1]; ++h)
-                                        row[this->outer[h]] = this->values[h];
+                                for(std::size_t h = this->pattern->inner[j]; h < this->pattern->inner[j + 1]; ++h)
+                                    row[this->pattern->outer[h]] = this->values[h];
 
-                                    // Result's row.
-                                    std::vector<T> product;
-                                    product.resize(matrix.columns(), static_cast<T>(0));
+                                // Result's row.
+                                std::vector<T> product;
+                                product.resize(matrix.columns(), static_cast<T>(0));
 
-                                    // Full iteration on matrix' non-zero elements.
-                                    for(const auto &[key, value]: matrix.elements)
-                                        product[key[1]] += row[key[0]] * value;
+                                // Full iteration on matrix' non-zero elements.
+                                for(const auto &[key, value]: matrix.elements)
+                                    product[key[1]] += row[key[0]] * value;
 
-                                    // Updates elements.
-                                    for(std::size_t h = 0; h < product.size(); ++h) {
-                                        if(std::abs(product[h]) > TOLERANCE_PACS) // Check needed.
-                                            elements[{j, h}] = product[h];
-                                    }
+                                // Updates elements.
+                                for(std::size_t h = 0; h < product.size(); ++h) {
+                                    if(std::abs(product[h]) > TOLERANCE_PACS) // Check needed.
+                                        elements[{j, h}] = product[h];
                                 }
-
                             }
+
                         } else {
                             if(matrix.compressed) {
 
@@ -780,8 +1971,8 @@ namespace pacs {
 
                                     // Linear combination of matrix' rows.
                                     for(std::size_t k = 0; k < matrix.rows(); ++k) { // k-th row of matrix.
-                                        for(std::size_t h = matrix.inner[k]; h < matrix.inner[k + 1]; ++h) {
-                                            product[matrix.outer[h]] += row[k] * matrix.values[h];
+                                        for(std::size_t h = matrix.pattern->inner[k]; h < matrix.pattern->inner[k + 1]; ++h) {
+                                            product[matrix.pattern->outer[h]] += row[k] * matrix.values[h];
                                         }
                                     }
 
@@ -832,70 +2023,40 @@ namespace pacs {
                     if constexpr (O == Column) {
 
                         if(this->compressed) {
-                            if(matrix.compressed) {
-
-                                // Iteration through matrix' columns.
-                                for(std::size_t j = 0; j < matrix.columns(); ++j) { // j-th column of matrix.
-
-                                    // Column extraction from matrix.
-                                    std::vector<T> column;
-                                    column.resize(matrix.rows(), static_cast<T>(0));
 
-                                    for(std::size_t k = matrix.inner[j]; k < matrix.inner[j + 1]; ++k)
-                                        column[matrix.outer[k]] = matrix.values[k];
+                            // Iteration through matrix' columns.
+                            auto stop = (*(--matrix.elements.end())).first;
+                            for(std::size_t j = 0; j < matrix.columns(); ++j) { // j-th column of matrix.
 
-                                    // Result's column.
-                                    std::vector<T> product;
-                                    product.resize(this->rows(), static_cast<T>(0));
+                                // Column extraction from matrix.
+                                std::vector<T> column;
+                                column.resize(matrix.rows(), static_cast<T>(0));
 
-                                    for(std::size_t k = 0; k < this->columns(); ++k) { // k-th column of this.
-                                        for(std::size_t h = this->inner[k]; h < this->inner[k + 1]; ++h)
-                                            product[this->outer[h]] += column[k] * this->values[h];
-                                    }
+                                for(auto it = matrix.elements.lower_bound({j, 0}); (*it).first < std::array<std::size_t, 2>{j + 1, 0}; ++it) {
+                                    column[(*it).first[1]] = (*it).second;
 
-                                    // Updates elements.
-                                    for(std::size_t h = 0; h < product.size(); ++h) {
-                                        if(std::abs(product[h]) > TOLERANCE_PACS) // Check needed.
-                                            elements[{j, h}] = product[h];
-                                    }
+                                    if((*it).first == stop) // May cause overhead.
+                                        break;
                                 }
 
-                            } else {
-
-                                // Iteration through matrix' columns.
-                                auto stop = (*(--matrix.elements.end())).first;
-                                for(std::size_t j = 0; j < matrix.columns(); ++j) { // j-th column of matrix.
-
-                                    // Column extraction from matrix.
-                                    std::vector<T> column;
-                                    column.resize(matrix.rows(), static_cast<T>(0));
-
-                                    for(auto it = matrix.elements.lower_bound({j, 0}); (*it).first < std::array<std::size_t, 2>{j + 1, 0}; ++it) {
-                                        column[(*it).first[1]] = (*it).second;
-
-                                        if((*it).first == stop) // May cause overhead.
-                                            break;
-                                    }
-
-                                    // Result's column.
-                                    std::vector<T> product;
-                                    product.resize(this->rows(), static_cast<T>(0));
-
-                                    // Linear combination of this' columns.
-                                    for(std::size_t k = 0; k < this->columns(); ++k) { // k-th column of this.
-                                        for(std::size_t h = this->inner[k]; h < this->inner[k + 1]; ++h) {
-                                            product[this->outer[h]] += column[k] * this->values[h];
-                                        }
-                                    }
+                                // Result's column.
+                                std::vector<T> product;
+                                product.resize(this->rows(), static_cast<T>(0));
 
-                                    // Updates elements.
-                                    for(std::size_t h = 0; h < product.size(); ++h) {
-                                        if(std::abs(product[h]) > TOLERANCE_PACS) // Check needed.
-                                            elements[{j, h}] = product[h];
+                                // Linear combination of this' columns.
+                                for(std::size_t k = 0; k < this->columns(); ++k) { // k-th column of this.
+                                    for(std::size_t h = this->pattern->inner[k]; h < this->pattern->inner[k + 1]; ++h) {
+                                        product[this->pattern->outer[h]] += column[k] * this->values[h];
                                     }
                                 }
 
+                                // Updates elements.
+                                for(std::size_t h = 0; h < product.size(); ++h) {
+                                    if(std::abs(product[h]) > TOLERANCE_PACS) // Check needed.
+                                        elements[{j, h}] = product[h];
+                                }
                             }
+
                         } else {
                             if(matrix.compressed) {
 
@@ -906,8 +2067,8 @@ namespace pacs {
                                     std::vector<T> column;
                                     column.resize(matrix.rows(), static_cast<T>(0));
 
-                                    for(std::size_t k = matrix.inner[j]; k < matrix.inner[j + 1]; ++k)
-                                        column[matrix.outer[k]] = matrix.values[k];
+                                    for(std::size_t k = matrix.pattern->inner[j]; k < matrix.pattern->inner[j + 1]; ++k)
+                                        column[matrix.pattern->outer[k]] = matrix.values[k];
 
                                     // Result's column.
                                     std::vector<T> product;
@@ -964,110 +2125,455 @@ namespace pacs {
                     return Matrix{this->rows(), matrix.columns(), elements};
                 }
 
-                // NORM.
+                // MASKED PRODUCTS.
 
                 /**
-                 * @brief Returns a norm for the Matrix.
+                 * @brief Returns the product of Matrix x Matrix (same ordering) within a structural mask, C<M> = A * B, or outside it if complemented.
+                 * Products falling outside the result's entries are skipped rather than computed and dropped; the mask's values are ignored.
                  *
-                 * @tparam N
-                 * @return double
+                 * @param matrix
+                 * @param mask
+                 * @param complement
+                 * @return Matrix
                  */
-                template<Norm N>
-                double norm() const {
-                    #ifdef PARALLEL_PACS
-                    auto absolute = [](const double &x) { return std::abs(x); };
-                    auto absolute_squared = [](const double &x) { return std::abs(x) * std::abs(x); };
-                    auto absolute_squared_map = [](auto &x) { return std::abs(x.second) * std::abs(x.second); };
+                Matrix masked(const Matrix &matrix, const Matrix &mask, const bool &complement = false) const {
+                    #ifndef NDEBUG
+                    assert(this->columns() == matrix.rows());
+                    assert((mask.rows() == this->rows()) && (mask.columns() == matrix.columns()));
                     #endif
 
-                    double norm = 0.0, max = 0.0;
+                    // General, compressed storage.
+                    if(this->symmetric || matrix.symmetric || mask.symmetric || !(this->compressed && matrix.compressed && mask.compressed)) {
+                        Matrix first = *this, second = matrix, pattern = mask;
 
-                    // On the secondary direction.
-                    if constexpr (N == One) {
+                        for(Matrix *general: {&first, &second, &pattern}) {
+                            general->compress();
+                            general->expand();
+                        }
 
-                        std::vector<double> sums;
-                        sums.resize(this->second, 0.0);
+                        return first.masked(second, pattern, complement);
+                    }
 
-                        if(!(this->compressed)) {
+                    if constexpr (O == Row)
+                        return gustavson(*this, matrix, this->first, matrix.second, &mask, complement);
+                    else
+                        return gustavson(matrix, *this, matrix.first, this->second, &mask, complement);
+                }
 
-                            for(const auto &[key, value]: this->elements)
-                                sums[key[1]] += std::abs(value);
+                /**
+                 * @brief Returns the product of Matrix x Vector within a structural mask, y<m> = A * x, or outside it if complemented.
+                 *
+                 * @param vector
+                 * @param mask Increasing rows' indices.
+                 * @param complement
+                 * @return std::vector<T>
+                 */
+                std::vector<T> masked(const std::vector<T> &vector, const std::vector<std::size_t> &mask, const bool &complement = false) const {
+                    std::vector<T> result;
+                    this->masked_product(vector, result, mask, complement);
 
-                        } else {
-                            
-                            for(std::size_t j = 0; j < this->values.size(); ++j)
-                                sums[this->outer[j]] += std::abs(this->values[j]);
+                    return result;
+                }
+
+                /**
+                 * @brief Writes the product of Matrix x Vector within a structural mask into result, reusing its storage. Rows outside the mask, or within it if complemented, are zero.
+                 * Row ordering computes the selected rows only, Column ordering skips the products falling on the others.
+                 *
+                 * @param vector
+                 * @param result
+                 * @param mask Increasing rows' indices.
+                 * @param complement
+                 */
+                void masked_product(const std::vector<T> &vector, std::vector<T> &result, const std::vector<std::size_t> &mask, const bool &complement = false) const {
+                    #ifndef NDEBUG
+                    assert(vector.size() == this->columns());
+                    assert(&vector != &result);
+                    assert(std::ranges::adjacent_find(mask, std::greater_equal<std::size_t>{}) == mask.end());
+                    assert(mask.empty() || (mask.back() < this->rows()));
+                    #endif
+
+                    // General, compressed storage.
+                    if(this->symmetric || !(this->compressed)) {
+                        Matrix general = *this;
+                        general.compress();
+                        general.expand();
+
+                        general.masked_product(vector, result, mask, complement);
+                        return;
+                    }
+
+                    result.resize(this->rows());
+
+                    if constexpr (O == Row) {
+                        auto row = [this, &vector, &result](const std::size_t &j) {
+                            T sum = static_cast<T>(0);
 
+                            for(std::size_t i = this->pattern->inner[j]; i < this->pattern->inner[j + 1]; ++i)
+                                sum += this->values[i] * vector[this->pattern->outer[i]];
+
+                            result[j] = sum;
+                        };
+
+                        if(!complement) {
+                            std::ranges::fill(result, static_cast<T>(0));
+                            each(mask.size(), [&mask, &row](const std::size_t &h) { row(mask[h]); });
+                        } else {
+                            std::vector<bool> excluded;
+                            excluded.resize(this->first, false);
+
+                            for(const auto &j: mask)
+                                excluded[j] = true;
+
+                            each(this->first, [&excluded, &result, &row](const std::size_t &j) {
+                                if(excluded[j])
+                                    result[j] = static_cast<T>(0);
+                                else
+                                    row(j);
+                            });
                         }
+                    }
 
-                        norm = std::ranges::max(sums);
+                    if constexpr (O == Column) {
+                        std::vector<bool> allowed;
+                        allowed.resize(this->second, complement);
+
+                        for(const auto &j: mask)
+                            allowed[j] = !complement;
 
+                        std::ranges::fill(result, static_cast<T>(0));
+
+                        // Linear combination of columns, rows in parallel.
+                        this->scattered([this, &vector, &result, &allowed](const std::size_t &j, const std::size_t &i) {
+                            if(allowed[this->pattern->outer[i]])
+                                result[this->pattern->outer[i]] += this->values[i] * vector[j];
+                        });
                     }
+                }
 
-                    // On the primary direction.
-                    if constexpr (N == Infinity) {
+                // NORM.
 
-                        if(!(this->compressed)) {
+                /**
+                 * @brief Returns the cached norms and rows' non zero elements statistics, see measure().
+                 *
+                 * @return const Norms&
+                 */
+                const Norms &norms() const {
+                    return this->cached(this->properties.norms, [this]() { return this->measure(); });
+                }
 
-                            std::vector<double> sums;
-                            sums.resize(this->first, 0.0);
+                /**
+                 * @brief Computes, uncached, the One, Infinity and Frobenius norms, the maximum absolute value and the rows' non zero elements statistics in a single pass.
+                 * Primary slices are split into SLABS_PACS slabs regardless of the number of threads, each reducing its own scalars, then slabs are merged pairwise in a fixed tree. Secondary slices' sums are split into ranges of secondary indices instead, each range scanning every primary slice in order, so that each secondary slice is summed in the same order whatever the ranges. Results are bit-reproducible and, besides the Matrix, take 16 bytes per secondary slice.
+                 *
+                 * @return Norms
+                 */
+                Norms measure() const {
+                    #ifdef PROFILING_PACS
+                    Probe probe{"norms", static_cast<double>(this->size()), 3.0 * static_cast<double>(this->size()), this->traffic()};
+                    #endif
 
-                            for(const auto &[key, value]: this->elements)
-                                sums[key[0]] += std::abs(value);
+                    const std::size_t range = this->symmetric ? this->first : this->second;
 
-                            norm = std::ranges::max(sums);
+                    // Primary slices' statistics.
+                    struct Slab {
+                        double squares = 0.0, maximum = 0.0, primary = 0.0;
+                        std::size_t nonzeros = 0, shortest = static_cast<std::size_t>(-1), longest = 0;
+                    };
 
-                        } else {
+                    // Secondary slices' sums and lengths.
+                    std::vector<double> sums;
+                    std::vector<std::size_t> counts;
+                    sums.resize(range, 0.0);
+                    counts.resize(range, 0);
+
+                    // Single element, primary statistics.
+                    auto add = [this](Slab &slab, const std::size_t &j, const std::size_t &k, const T &value) {
+                        const double absolute = std::abs(value);
+                        const bool mirrored = this->symmetric && (j != k);
+
+                        slab.squares += mirrored ? 2.0 * absolute * absolute : absolute * absolute;
+                        slab.maximum = std::max(slab.maximum, absolute);
+                        slab.nonzeros += mirrored ? 2 : 1;
+
+                        return absolute;
+                    };
+
+                    // Pairwise merge, second into first.
+                    auto merge = [](Slab &first, const Slab &second) {
+                        first.squares += second.squares;
+                        first.maximum = std::max(first.maximum, second.maximum);
+                        first.primary = std::max(first.primary, second.primary);
+                        first.nonzeros += second.nonzeros;
+                        first.shortest = std::min(first.shortest, second.shortest);
+                        first.longest = std::max(first.longest, second.longest);
+                    };
+
+                    std::vector<Slab> slabs;
+
+                    if(!(this->compressed)) { // Slower.
+                        slabs.resize(1);
+
+                        std::vector<double> primary;
+                        std::vector<std::size_t> lengths;
+                        primary.resize(this->first, 0.0);
+                        lengths.resize(this->first, 0);
+
+                        for(const auto &[key, value]: this->elements) {
+                            const double absolute = add(slabs[0], key[0], key[1], value);
 
-                            for(std::size_t j = 0; j < this->inner.size() - 1; ++j) {
+                            primary[key[0]] += absolute;
+                            ++lengths[key[0]];
 
-                                #ifdef PARALLEL_PACS
-                                double sum = std::transform_reduce(std::execution::par, this->values.begin() + this->inner[j], this->values.begin() + this->inner[j + 1], 0.0, std::plus{}, absolute);
-                                #else
+                            sums[key[1]] += absolute;
+                            ++counts[key[1]];
+
+                            if(this->symmetric && (key[0] != key[1])) {
+                                sums[key[0]] += absolute;
+                                ++counts[key[0]];
+                            }
+                        }
+
+                        slabs[0].primary = std::ranges::max(primary);
+                        slabs[0].shortest = std::ranges::min(lengths);
+                        slabs[0].longest = std::ranges::max(lengths);
+                    } else {
+                        const std::size_t count = std::min(this->first, static_cast<std::size_t>(SLABS_PACS));
+                        slabs.resize(count);
+
+                        auto slab = [this, &count, &slabs, &add](const std::size_t &s) {
+                            Slab &slab = slabs[s];
+
+                            for(std::size_t j = s * this->first / count; j < (s + 1) * this->first / count; ++j) {
                                 double sum = 0.0;
 
-                                for(std::size_t k = this->inner[j]; k < this->inner[j + 1]; ++k)
-                                    sum += this->values[k];
-                                #endif
+                                for(std::size_t k = this->pattern->inner[j]; k < this->pattern->inner[j + 1]; ++k)
+                                    sum += add(slab, j, this->pattern->outer[k], this->values[k]);
 
-                                max = sum > max ? sum : max;
+                                slab.primary = std::max(slab.primary, sum);
+                                slab.shortest = std::min(slab.shortest, this->pattern->inner[j + 1] - this->pattern->inner[j]);
+                                slab.longest = std::max(slab.longest, this->pattern->inner[j + 1] - this->pattern->inner[j]);
                             }
+                        };
 
-                            norm = max;
+                        each(count, slab);
 
+                        // Tree merge.
+                        for(std::size_t step = 1; step < count; step *= 2) {
+                            each((count + 2 * step - 1) / (2 * step), [&slabs, &count, &step, &merge](const std::size_t &pair) {
+                                if(2 * pair * step + step < count)
+                                    merge(slabs[2 * pair * step], slabs[2 * pair * step + step]);
+                            });
                         }
 
+                        // Secondary ranges, any number of them, one per thread as each scans every primary slice.
+                        #ifdef PARALLEL_PACS
+                        const std::size_t ranges = std::min(range, Pool::instance().threads());
+                        #else
+                        const std::size_t ranges = 1;
+                        #endif
+
+                        each(ranges, [this, &range, &ranges, &sums, &counts](const std::size_t &r) {
+                            const std::size_t lower = r * range / ranges, upper = (r + 1) * range / ranges;
+                            const auto &outer = this->pattern->outer;
+
+                            for(std::size_t j = 0; j < this->first; ++j) {
+                                const std::size_t start = this->pattern->inner[j], end = this->pattern->inner[j + 1];
+
+                                if(start == end)
+                                    continue;
+
+                                // Elements within the range, secondary indices are sorted.
+                                if((outer[start] < upper) && (outer[end - 1] >= lower)) {
+                                    const std::size_t first = std::lower_bound(outer.begin() + start, outer.begin() + end, lower) - outer.begin();
+                                    const std::size_t last = std::lower_bound(outer.begin() + first, outer.begin() + end, upper) - outer.begin();
+
+                                    for(std::size_t k = first; k < last; ++k) {
+                                        sums[outer[k]] += std::abs(this->values[k]);
+                                        ++counts[outer[k]];
+                                    }
+                                }
+
+                                // Mirrored elements, the j-th slice's.
+                                if(this->symmetric && (j >= lower) && (j < upper)) {
+                                    for(std::size_t k = start; k < end; ++k) {
+                                        if(outer[k] != j) {
+                                            sums[j] += std::abs(this->values[k]);
+                                            ++counts[j];
+                                        }
+                                    }
+                                }
+                            }
+                        });
+                    }
+
+                    // Secondary statistics, untouched indices included.
+                    const Slab &total = slabs[0];
+
+                    const double secondary = std::ranges::max(sums);
+                    const std::size_t shortest = std::ranges::min(counts);
+                    const std::size_t longest = std::ranges::max(counts);
+
+                    Norms norms;
+                    norms.frobenius = std::sqrt(total.squares);
+                    norms.maximum = total.maximum;
+                    norms.nonzeros = total.nonzeros;
+                    norms.mean = static_cast<double>(total.nonzeros) / static_cast<double>(this->rows());
+
+                    if(this->symmetric) {
+                        norms.one = norms.infinity = secondary;
+                        norms.shortest = shortest;
+                        norms.longest = longest;
+                    } else if constexpr (O == Row) {
+                        norms.one = secondary;
+                        norms.infinity = total.primary;
+                        norms.shortest = total.shortest;
+                        norms.longest = total.longest;
+                    } else {
+                        norms.one = total.primary;
+                        norms.infinity = secondary;
+                        norms.shortest = shortest;
+                        norms.longest = longest;
                     }
 
-                    if constexpr (N == Frobenius) {
+                    return norms;
+                }
+
+                /**
+                 * @brief Returns a norm for the Matrix.
+                 *
+                 * @tparam N
+                 * @return double
+                 */
+                template<Norm N>
+                double norm() const {
+                    const Norms &norms = this->norms();
+
+                    if constexpr (N == One)
+                        return norms.one;
+
+                    if constexpr (N == Infinity)
+                        return norms.infinity;
+
+                    return norms.frobenius;
+                }
+
+                // PROPERTIES.
+
+                /**
+                 * @brief Returns the cached main diagonal.
+                 *
+                 * @return const std::vector<T>&
+                 */
+                const std::vector<T> &diagonal() const {
+                    return this->cached(this->properties.diagonal, [this]() {
+                        std::vector<T> diagonal;
+                        diagonal.resize(std::min(this->first, this->second), static_cast<T>(0));
 
                         if(!(this->compressed)) {
+                            for(std::size_t j = 0; j < diagonal.size(); ++j) {
+                                auto it = this->elements.find({j, j});
 
-                            #ifdef PARALLEL_PACS
-                            norm = std::sqrt(std::transform_reduce(std::execution::par, this->elements.begin(), this->elements.end(), 0.0, std::plus{}, absolute_squared_map));
-                            #else
-                            for(const auto &[key, value]: this->elements)
-                                norm += static_cast<double>(std::abs(value) * std::abs(value));
+                                if(it != this->elements.end())
+                                    diagonal[j] = it->second;
+                            }
+                        } else {
+                            each(diagonal.size(), [this, &diagonal](const std::size_t &j) {
+                                const auto begin = this->pattern->outer.begin() + this->pattern->inner[j], end = this->pattern->outer.begin() + this->pattern->inner[j + 1];
+                                const auto it = std::lower_bound(begin, end, j);
 
-                            norm = std::sqrt(norm);
-                            #endif
+                                if((it != end) && (*it == j))
+                                    diagonal[j] = this->values[it - this->pattern->outer.begin()];
+                            });
+                        }
+
+                        return diagonal;
+                    });
+                }
+
+                /**
+                 * @brief Returns the cached numerical symmetry, A = A^T within TOLERANCE_PACS.
+                 * Symmetric storage is symmetric by construction, see is_symmetric().
+                 *
+                 * @return true
+                 * @return false
+                 */
+                bool symmetry() const {
+                    if((this->first != this->second) || this->symmetric)
+                        return this->symmetric;
+
+                    return this->cached(this->properties.symmetry, [this]() {
+                        bool symmetry = true;
+
+                        if(!(this->compressed)) {
+                            for(const auto &[key, value]: this->elements) {
+                                auto it = this->elements.find({key[1], key[0]});
 
+                                if(std::abs(value - ((it != this->elements.end()) ? it->second : static_cast<T>(0))) > TOLERANCE_PACS) {
+                                    symmetry = false;
+                                    break;
+                                }
+                            }
                         } else {
+                            symmetry = reduced<bool>(this->first, true, [this](const std::size_t &j) {
+                                for(std::size_t k = this->pattern->inner[j]; k < this->pattern->inner[j + 1]; ++k) {
+                                    const std::size_t i = this->pattern->outer[k];
+                                    const auto begin = this->pattern->outer.begin() + this->pattern->inner[i], end = this->pattern->outer.begin() + this->pattern->inner[i + 1];
+                                    const auto it = std::lower_bound(begin, end, j);
+                                    const T transposed = ((it != end) && (*it == j)) ? this->values[it - this->pattern->outer.begin()] : static_cast<T>(0);
+
+                                    if(std::abs(this->values[k] - transposed) > TOLERANCE_PACS)
+                                        return false;
+                                }
 
-                            #ifdef PARALLEL_PACS
-                            norm = std::sqrt(std::transform_reduce(std::execution::par, this->values.begin(), this->values.end(), 0.0, std::plus{}, absolute_squared));
-                            #else
-                            for(const auto &value: this->values)
-                                norm += static_cast<double>(std::abs(value) * std::abs(value));
+                                return true;
+                            }, [](const bool &first, const bool &second) { return first && second; });
+                        }
 
-                            norm = std::sqrt(norm);
-                            #endif
+                        return symmetry;
+                    });
+                }
+
+                /**
+                 * @brief Returns the cached lower and upper bandwidths, the largest row - column and column - row distances among non zero elements.
+                 *
+                 * @return std::array<std::size_t, 2>
+                 */
+                std::array<std::size_t, 2> bandwidth() const {
+                    return this->cached(this->properties.bandwidth, [this]() {
+                        // Storage order bandwidths, {below, above}.
+                        using Band = std::array<std::size_t, 2>;
+
+                        auto distance = [](const std::size_t &j, const std::size_t &k) -> Band {
+                            return {j > k ? j - k : 0, k > j ? k - j : 0};
+                        };
 
+                        auto widest = [](const Band &first, const Band &second) -> Band {
+                            return {std::max(first[0], second[0]), std::max(first[1], second[1])};
+                        };
+
+                        Band band{0, 0};
+
+                        if(!(this->compressed)) {
+                            for(const auto &[key, value]: this->elements)
+                                band = widest(band, distance(key[0], key[1]));
+                        } else {
+                            band = reduced<Band>(this->first, band, [this, &distance, &widest](const std::size_t &j) -> Band {
+                                if(this->pattern->inner[j] == this->pattern->inner[j + 1])
+                                    return {0, 0};
+
+                                // Sorted slices, extremes only.
+                                return widest(distance(j, this->pattern->outer[this->pattern->inner[j]]), distance(j, this->pattern->outer[this->pattern->inner[j + 1] - 1]));
+                            }, widest);
                         }
 
-                    }
+                        if(this->symmetric)
+                            band[0] = band[1] = std::max(band[0], band[1]);
+
+                        if constexpr (O == Column)
+                            std::swap(band[0], band[1]);
 
-                    return norm;
+                        return band;
+                    });
                 }
 
                 // METHODS.
@@ -1078,10 +2584,25 @@ namespace pacs {
                  * @return std::size_t 
                  */
                 inline std::size_t size() const {
-                    if(!(this->compressed))
-                        return this->elements.size();
+                    const std::size_t stored = this->compressed ? this->values.size() : this->elements.size();
+
+                    if(!(this->symmetric))
+                        return stored;
+
+                    return this->cached(this->properties.size, [this, &stored]() {
+                        // Implied elements.
+                        std::size_t diagonal = 0;
+
+                        if(!(this->compressed)) {
+                            for(const auto &[key, value]: this->elements)
+                                diagonal += key[0] == key[1];
+                        } else {
+                            for(std::size_t j = 0; j < this->first; ++j)
+                                diagonal += (this->pattern->inner[j] < this->pattern->inner[j + 1]) && (this->pattern->outer[this->pattern->inner[j]] == j);
+                        }
 
-                    return this->values.size();
+                        return 2 * stored - diagonal;
+                    });
                 }
 
                 /**
@@ -1131,10 +2652,10 @@ namespace pacs {
 
                     } else {
                         for(std::size_t j = 0; j < matrix.first; ++j) {
-                            for(std::size_t k = matrix.inner[j]; k < matrix.inner[j + 1]; ++k) {
-                                ost << "(" << j << ", " << matrix.outer[k] << "): " << matrix.values[k];
+                            for(std::size_t k = matrix.pattern->inner[j]; k < matrix.pattern->inner[j + 1]; ++k) {
+                                ost << "(" << j << ", " << matrix.pattern->outer[k] << "): " << matrix.values[k];
 
-                                if(k < matrix.inner[matrix.first] - 1)
+                                if(k < matrix.pattern->inner[matrix.first] - 1)
                                     ost << std::endl;
                             }
 
@@ -1156,41 +2677,41 @@ namespace pacs {
                     assert(!(this->compressed));
                     #endif
 
-                    return this->elements;
+                    return {this->elements.begin(), this->elements.end()};
                 }
 
                 /**
                  * @brief Get the inner vector.
                  * 
-                 * @return std::vector<std::size_t> 
+                 * @return const Vector<std::size_t>& 
                  */
-                std::vector<std::size_t> get_inner() const {
+                const Vector<std::size_t> &get_inner() const {
                     #ifndef NDEBUG
                     assert(this->compressed);
                     #endif
 
-                    return this->inner;
+                    return this->pattern->inner;
                 }
                 
                 /**
                  * @brief Get the outer vector.
                  * 
-                 * @return std::vector<std::size_t> 
+                 * @return const Vector<std::size_t>& 
                  */
-                std::vector<std::size_t> get_outer() const {
+                const Vector<std::size_t> &get_outer() const {
                     #ifndef NDEBUG
                     assert(this->compressed);
                     #endif
 
-                    return this->outer;
+                    return this->pattern->outer;
                 }
 
                 /**
                  * @brief Get the values vector.
                  * 
-                 * @return std::vector<T> 
+                 * @return const Vector<T>& 
                  */
-                std::vector<T> get_values() const {
+                const Vector<T> &get_values() const {
                     #ifndef NDEBUG
                     assert(this->compressed);
                     #endif
@@ -1199,6 +2720,56 @@ namespace pacs {
                 }
         };
 
+        // CONVERSIONS.
+
+        /**
+         * @brief Extracts a compressed Matrix' CSR arrays, expanding symmetric storage and transposing Column order.
+         *
+         * @tparam T
+         * @tparam O
+         * @param matrix
+         * @param inner
+         * @param outer
+         * @param values
+         */
+        template<MatrixType T, Order O>
+        void rows_of(const Matrix<T, O> &matrix, Vector<std::size_t> &inner, Vector<std::size_t> &outer, Vector<T> &values) {
+            #ifndef NDEBUG
+            assert(matrix.is_compressed());
+            #endif
+
+            Matrix<T, O> expanded = matrix;
+            expanded.expand();
+
+            const auto &s_inner = expanded.get_inner();
+            const auto &s_outer = expanded.get_outer();
+            const auto &s_values = expanded.get_values();
+
+            if constexpr (O == Row) {
+                inner.assign(s_inner.begin(), s_inner.end());
+                outer.assign(s_outer.begin(), s_outer.end());
+                values.assign(s_values.begin(), s_values.end());
+            } else {
+                inner.assign(expanded.rows() + 1, 0);
+                outer.resize(s_outer.size());
+                values.resize(s_values.size());
+
+                for(const auto &row: s_outer)
+                    ++inner[row + 1];
+
+                std::inclusive_scan(inner.begin(), inner.end(), inner.begin());
+                std::vector<std::size_t> cursors(inner.begin(), inner.end() - 1);
+
+                // Columns in increasing order keep rows sorted.
+                for(std::size_t j = 0; j + 1 < s_inner.size(); ++j) {
+                    for(std::size_t k = s_inner[j]; k < s_inner[j + 1]; ++k) {
+                        outer[cursors[s_outer[k]]] = j;
+                        values[cursors[s_outer[k]]++] = s_values[k];
+                    }
+                }
+            }
+        }
+
     }
 
 }
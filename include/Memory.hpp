@@ -0,0 +1,202 @@
+/**
+ * @file Memory.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-04-23
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef MEMORY_PACS
+#define MEMORY_PACS
+
+// Containers.
+#include <vector>
+
+// Memory.
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+// Policy.
+#include <atomic>
+#include <cstdlib>
+
+// Huge pages.
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+// Cache line size.
+#ifndef ALIGNMENT_PACS
+#define ALIGNMENT_PACS 64
+#endif
+
+// Huge page size, also the smallest allocation backed by huge pages.
+#ifndef HUGE_PACS
+#define HUGE_PACS (1 << 21)
+#endif
+
+namespace pacs {
+
+    namespace algebra {
+
+        /**
+         * @brief Cache-aligned allocator.
+         *
+         * @tparam V
+         */
+        template<typename V>
+        struct Aligned {
+            using value_type = V;
+
+            Aligned() = default;
+
+            template<typename U>
+            Aligned(const Aligned<U> &) {}
+
+            V *allocate(const std::size_t &size) {
+                return static_cast<V *>(::operator new(size * sizeof(V), std::align_val_t{ALIGNMENT_PACS}));
+            }
+
+            void deallocate(V *pointer, const std::size_t &) {
+                ::operator delete(pointer, std::align_val_t{ALIGNMENT_PACS});
+            }
+
+            template<typename U>
+            bool operator ==(const Aligned<U> &) const {
+                return true;
+            }
+        };
+
+        /**
+         * @brief Contiguous, cache-aligned storage.
+         *
+         * @tparam V
+         */
+        template<typename V>
+        using Block = std::vector<V, Aligned<V>>;
+
+        /**
+         * @brief Huge pages policy for Vector storage, opt-in through configure or PACS_HUGE=1.
+         * Vectors follow the policy in force when they are built, and keep it.
+         *
+         */
+        class Pages {
+            private:
+
+                static std::atomic<bool> &flag() {
+                    static std::atomic<bool> huge{[]() { const char *value = std::getenv("PACS_HUGE"); return (value != nullptr) && (std::atoi(value) != 0); }()};
+                    return huge;
+                }
+
+            public:
+
+                /**
+                 * @brief Returns whether new Vectors are backed by huge pages.
+                 *
+                 * @return true
+                 * @return false
+                 */
+                static bool huge() {
+                    return flag().load();
+                }
+
+                /**
+                 * @brief Sets whether new Vectors are backed by huge pages.
+                 *
+                 * @param huge
+                 */
+                static void configure(const bool &huge) {
+                    flag().store(huge);
+                }
+        };
+
+        /**
+         * @brief Cache-aligned allocator leaving value-less constructions default-initialized.
+         * Resizing does not write fresh memory, so that pages get placed by their first writer (first touch).
+         * Under the huge pages policy, allocations of at least HUGE_PACS bytes are aligned to it, rounded up to it and advised as transparent huge pages.
+         *
+         * @tparam V
+         */
+        template<typename V>
+        struct Untouched: Aligned<V> {
+            bool huge = Pages::huge();
+
+            // The policy travels with the storage.
+            using propagate_on_container_copy_assignment = std::true_type;
+            using propagate_on_container_move_assignment = std::true_type;
+            using propagate_on_container_swap = std::true_type;
+
+            Untouched() = default;
+
+            template<typename U>
+            Untouched(const Untouched<U> &allocator): huge{allocator.huge} {}
+
+            V *allocate(const std::size_t &size) {
+                const std::size_t bytes = size * sizeof(V);
+
+                if(!(this->huge) || (bytes < HUGE_PACS))
+                    return Aligned<V>::allocate(size);
+
+                const std::size_t rounded = (bytes + HUGE_PACS - 1) / HUGE_PACS * HUGE_PACS;
+                void *pointer = ::operator new(rounded, std::align_val_t{HUGE_PACS});
+
+                #if defined(__linux__) && defined(MADV_HUGEPAGE)
+                madvise(pointer, rounded, MADV_HUGEPAGE); // Advisory, failures are harmless.
+                #endif
+
+                return static_cast<V *>(pointer);
+            }
+
+            void deallocate(V *pointer, const std::size_t &size) {
+                if(!(this->huge) || (size * sizeof(V) < HUGE_PACS))
+                    return Aligned<V>::deallocate(pointer, size);
+
+                ::operator delete(pointer, std::align_val_t{HUGE_PACS});
+            }
+
+            template<typename U>
+            bool operator ==(const Untouched<U> &allocator) const {
+                return this->huge == allocator.huge;
+            }
+
+            template<typename U>
+            void construct(U *pointer) {
+                ::new(static_cast<void *>(pointer)) U;
+            }
+
+            template<typename U, typename... A>
+            void construct(U *pointer, A &&...arguments) {
+                ::new(static_cast<void *>(pointer)) U(std::forward<A>(arguments)...);
+            }
+        };
+
+        /**
+         * @brief Contiguous, cache-aligned storage placed by first touch.
+         *
+         * @tparam V
+         */
+        template<typename V>
+        using Vector = std::vector<V, Untouched<V>>;
+
+        /**
+         * @brief Returns size rounded up to a whole number of cache lines.
+         *
+         * @tparam V
+         * @param size
+         * @return constexpr std::size_t
+         */
+        template<typename V>
+        constexpr std::size_t padded(const std::size_t &size) {
+            constexpr std::size_t line = ALIGNMENT_PACS > sizeof(V) ? ALIGNMENT_PACS / sizeof(V) : 1;
+            return (size + line - 1) / line * line;
+        }
+
+    }
+
+}
+
+#endif
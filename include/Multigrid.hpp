@@ -0,0 +1,529 @@
+/**
+ * @file Multigrid.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-04-25
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef MULTIGRID_PACS
+#define MULTIGRID_PACS
+
+// Type.
+#include <Type.hpp>
+
+// Matrix.
+#include <Matrix.hpp>
+
+// Containers.
+#include <vector>
+#include <array>
+
+// Assertions.
+#include <cassert>
+
+// Algorithms.
+#include <algorithm>
+#include <numeric>
+
+// Math.
+#include <cmath>
+#include <cstdint>
+
+// Coarsening stops above this ratio of coarse over fine nodes.
+#ifndef COARSENING_PACS
+#define COARSENING_PACS 0.9
+#endif
+
+namespace pacs {
+
+    namespace algebra {
+
+        /**
+         * @brief Multigrid smoothers.
+         *
+         */
+        enum Smoother {Jacobi, Chebyshev};
+
+        /**
+         * @brief Smoothed aggregation algebraic multigrid, applied as a V-cycle preconditioner.
+         *
+         * @tparam T
+         */
+        template<MatrixType T>
+        class AMG {
+            private:
+
+                // Hierarchy, finest first.
+                std::vector<Matrix<T, Row>> operators;
+                std::vector<Matrix<T, Row>> prolongations;
+                std::vector<Matrix<T, Row>> restrictions;
+
+                // Inverse diagonals and spectral radii of D^{-1} A.
+                std::vector<std::vector<T>> diagonals;
+                std::vector<double> radii;
+
+                // Coarsest level, dense LU factors and pivots.
+                std::vector<T> dense;
+                std::vector<std::size_t> pivots;
+
+                // Smoothing.
+                Smoother smoother;
+                std::size_t sweeps;
+
+                // Work vectors: solution, right-hand side, residual, temporary and direction, by level.
+                mutable std::vector<std::array<std::vector<T>, 5>> work;
+
+                // SETUP.
+
+                /**
+                 * @brief Returns the inverse diagonal of a compressed matrix.
+                 *
+                 * @param matrix
+                 * @return std::vector<T>
+                 */
+                static std::vector<T> inverse_diagonal(const Matrix<T, Row> &matrix) {
+                    const auto &inner = matrix.get_inner();
+                    const auto &outer = matrix.get_outer();
+                    const auto &values = matrix.get_values();
+
+                    std::vector<T> diagonal;
+                    diagonal.resize(matrix.rows(), static_cast<T>(1));
+
+                    for(std::size_t j = 0; j < matrix.rows(); ++j) {
+                        for(std::size_t k = inner[j]; k < inner[j + 1]; ++k) {
+                            if((outer[k] == j) && (std::abs(values[k]) > 0.0))
+                                diagonal[j] = static_cast<T>(1) / values[k];
+                        }
+                    }
+
+                    return diagonal;
+                }
+
+                /**
+                 * @brief Estimates the spectral radius of D^{-1} A by power iteration.
+                 *
+                 * @param matrix
+                 * @param diagonal
+                 * @return double
+                 */
+                static double radius(const Matrix<T, Row> &matrix, const std::vector<T> &diagonal) {
+                    std::vector<T> x, y;
+                    x.resize(matrix.rows());
+
+                    // Deterministic, rough start.
+                    std::uint64_t state = 0x9E3779B97F4A7C15;
+
+                    for(std::size_t j = 0; j < x.size(); ++j) {
+                        state = state * 6364136223846793005 + 1442695040888963407;
+                        x[j] = static_cast<T>(static_cast<double>(state >> 11) / 9007199254740992.0 - 0.5);
+                    }
+
+                    double estimate = 1.0;
+
+                    for(std::size_t iteration = 0; iteration < 20; ++iteration) {
+                        double norm_x = 0.0, norm_y = 0.0;
+                        matrix.product(x, y);
+
+                        for(std::size_t j = 0; j < y.size(); ++j) {
+                            y[j] *= diagonal[j];
+                            norm_x += std::abs(x[j]) * std::abs(x[j]);
+                            norm_y += std::abs(y[j]) * std::abs(y[j]);
+                        }
+
+                        if(norm_y == 0.0)
+                            break;
+
+                        estimate = std::sqrt(norm_y / norm_x);
+
+                        for(std::size_t j = 0; j < y.size(); ++j)
+                            x[j] = y[j] / static_cast<T>(std::sqrt(norm_y));
+                    }
+
+                    return estimate;
+                }
+
+                /**
+                 * @brief Aggregates the strongly connected nodes of a compressed matrix.
+                 * Strength: |a_jk| >= theta * sqrt(|a_jj a_kk|).
+                 *
+                 * @param matrix
+                 * @param diagonal Inverse diagonal.
+                 * @param theta
+                 * @param aggregates Aggregate of each node.
+                 * @return std::size_t Number of aggregates.
+                 */
+                static std::size_t aggregate(const Matrix<T, Row> &matrix, const std::vector<T> &diagonal, const double &theta, std::vector<std::size_t> &aggregates) {
+                    const auto &inner = matrix.get_inner();
+                    const auto &outer = matrix.get_outer();
+                    const auto &values = matrix.get_values();
+                    const std::size_t size = matrix.rows();
+
+                    // Strength of connection filtering.
+                    std::vector<std::size_t> strong_inner, strong_outer;
+                    strong_inner.resize(size + 1, 0);
+
+                    for(std::size_t j = 0; j < size; ++j) {
+                        for(std::size_t k = inner[j]; k < inner[j + 1]; ++k) {
+                            const std::size_t i = outer[k];
+
+                            if((i != j) && (std::abs(values[k]) * std::abs(values[k]) >= theta * theta / std::abs(diagonal[j] * diagonal[i])))
+                                strong_outer.emplace_back(i);
+                        }
+
+                        strong_inner[j + 1] = strong_outer.size();
+                    }
+
+                    const std::size_t none = size;
+                    std::size_t count = 0;
+                    aggregates.assign(size, none);
+
+                    // First phase, roots with entirely free neighbourhoods.
+                    for(std::size_t j = 0; j < size; ++j) {
+                        if(aggregates[j] != none)
+                            continue;
+
+                        bool free = true;
+
+                        for(std::size_t k = strong_inner[j]; (k < strong_inner[j + 1]) && free; ++k)
+                            free = aggregates[strong_outer[k]] == none;
+
+                        if(!free)
+                            continue;
+
+                        aggregates[j] = count;
+
+                        for(std::size_t k = strong_inner[j]; k < strong_inner[j + 1]; ++k)
+                            aggregates[strong_outer[k]] = count;
+
+                        ++count;
+                    }
+
+                    // Second phase, free nodes join a neighbouring aggregate.
+                    std::vector<std::size_t> first{aggregates};
+
+                    for(std::size_t j = 0; j < size; ++j) {
+                        if(first[j] != none)
+                            continue;
+
+                        for(std::size_t k = strong_inner[j]; k < strong_inner[j + 1]; ++k) {
+                            if(first[strong_outer[k]] != none) {
+                                aggregates[j] = first[strong_outer[k]];
+                                break;
+                            }
+                        }
+                    }
+
+                    // Third phase, leftovers aggregate with their free neighbourhoods.
+                    for(std::size_t j = 0; j < size; ++j) {
+                        if(aggregates[j] != none)
+                            continue;
+
+                        aggregates[j] = count;
+
+                        for(std::size_t k = strong_inner[j]; k < strong_inner[j + 1]; ++k) {
+                            if(aggregates[strong_outer[k]] == none)
+                                aggregates[strong_outer[k]] = count;
+                        }
+
+                        ++count;
+                    }
+
+                    return count;
+                }
+
+                /**
+                 * @brief Factorizes the coarsest operator, dense LU with partial pivoting.
+                 *
+                 */
+                void factorize() {
+                    const Matrix<T, Row> &matrix = this->operators.back();
+                    const std::size_t size = matrix.rows();
+
+                    const auto &inner = matrix.get_inner();
+                    const auto &outer = matrix.get_outer();
+                    const auto &values = matrix.get_values();
+
+                    this->dense.assign(size * size, static_cast<T>(0));
+                    this->pivots.resize(size);
+
+                    for(std::size_t j = 0; j < size; ++j) {
+                        for(std::size_t k = inner[j]; k < inner[j + 1]; ++k)
+                            this->dense[j * size + outer[k]] = values[k];
+                    }
+
+                    for(std::size_t k = 0; k < size; ++k) {
+                        std::size_t pivot = k;
+
+                        for(std::size_t j = k + 1; j < size; ++j) {
+                            if(std::abs(this->dense[j * size + k]) > std::abs(this->dense[pivot * size + k]))
+                                pivot = j;
+                        }
+
+                        this->pivots[k] = pivot;
+
+                        if(pivot != k)
+                            std::swap_ranges(this->dense.begin() + k * size, this->dense.begin() + (k + 1) * size, this->dense.begin() + pivot * size);
+
+                        if(std::abs(this->dense[k * size + k]) == 0.0) // Singular coarse operator.
+                            this->dense[k * size + k] = static_cast<T>(1);
+
+                        for(std::size_t j = k + 1; j < size; ++j) {
+                            const T factor = this->dense[j * size + k] /= this->dense[k * size + k];
+
+                            for(std::size_t i = k + 1; i < size; ++i)
+                                this->dense[j * size + i] -= factor * this->dense[k * size + i];
+                        }
+                    }
+                }
+
+                // CYCLE.
+
+                /**
+                 * @brief Smooths x on a given level.
+                 *
+                 * @param level
+                 * @param b
+                 * @param x
+                 */
+                void smooth(const std::size_t &level, const std::vector<T> &b, std::vector<T> &x) const {
+                    const Matrix<T, Row> &matrix = this->operators[level];
+                    const std::vector<T> &diagonal = this->diagonals[level];
+                    std::vector<T> &r = this->work[level][2], &t = this->work[level][3], &d = this->work[level][4];
+                    const std::size_t size = b.size();
+
+                    if(this->smoother == Jacobi) {
+                        const T omega = static_cast<T>(4.0 / (3.0 * this->radii[level]));
+
+                        for(std::size_t sweep = 0; sweep < this->sweeps; ++sweep) {
+                            matrix.product(x, t);
+
+                            for(std::size_t j = 0; j < size; ++j)
+                                x[j] += omega * diagonal[j] * (b[j] - t[j]);
+                        }
+
+                        return;
+                    }
+
+                    // Chebyshev polynomial of degree sweeps on [radius / 30, 1.1 * radius].
+                    const double upper = 1.1 * this->radii[level], lower = upper / 30.0;
+                    const double theta = (upper + lower) / 2.0, delta = (upper - lower) / 2.0, sigma = theta / delta;
+                    double rho = 1.0 / sigma;
+
+                    matrix.product(x, t);
+                    r.resize(size);
+                    d.resize(size);
+
+                    for(std::size_t j = 0; j < size; ++j) {
+                        r[j] = b[j] - t[j];
+                        d[j] = diagonal[j] * r[j] / static_cast<T>(theta);
+                    }
+
+                    for(std::size_t degree = 0; degree < this->sweeps; ++degree) {
+                        for(std::size_t j = 0; j < size; ++j)
+                            x[j] += d[j];
+
+                        if(degree + 1 == this->sweeps)
+                            break;
+
+                        const double next = 1.0 / (2.0 * sigma - rho);
+                        matrix.product(d, t);
+
+                        for(std::size_t j = 0; j < size; ++j) {
+                            r[j] -= t[j];
+                            d[j] = static_cast<T>(next * rho) * d[j] + static_cast<T>(2.0 * next / delta) * diagonal[j] * r[j];
+                        }
+
+                        rho = next;
+                    }
+                }
+
+                /**
+                 * @brief V-cycle from a zero initial guess.
+                 *
+                 * @param level
+                 * @param b
+                 * @param x
+                 */
+                void cycle(const std::size_t &level, const std::vector<T> &b, std::vector<T> &x) const {
+                    const std::size_t size = b.size();
+                    x.assign(size, static_cast<T>(0));
+
+                    // Coarsest level, smoothed when too large, as its smoother was kept.
+                    if((level + 1 == this->operators.size()) && (level < this->diagonals.size())) {
+                        this->smooth(level, b, x);
+                        return;
+                    }
+
+                    // Coarsest level, direct solve.
+                    if(level + 1 == this->operators.size()) {
+                        for(std::size_t k = 0; k < size; ++k)
+                            x[k] = b[k];
+
+                        for(std::size_t k = 0; k < size; ++k)
+                            std::swap(x[k], x[this->pivots[k]]);
+
+                        for(std::size_t j = 0; j < size; ++j) {
+                            for(std::size_t k = 0; k < j; ++k)
+                                x[j] -= this->dense[j * size + k] * x[k];
+                        }
+
+                        for(std::size_t j = size; j-- > 0;) {
+                            for(std::size_t k = j + 1; k < size; ++k)
+                                x[j] -= this->dense[j * size + k] * x[k];
+
+                            x[j] /= this->dense[j * size + j];
+                        }
+
+                        return;
+                    }
+
+                    std::vector<T> &r = this->work[level][2], &t = this->work[level][3];
+                    std::vector<T> &coarse_x = this->work[level + 1][0], &coarse_b = this->work[level + 1][1];
+
+                    // Pre-smoothing.
+                    this->smooth(level, b, x);
+
+                    // Coarse grid correction.
+                    this->operators[level].product(x, t);
+                    r.resize(size);
+
+                    for(std::size_t j = 0; j < size; ++j)
+                        r[j] = b[j] - t[j];
+
+                    this->restrictions[level].product(r, coarse_b);
+                    this->cycle(level + 1, coarse_b, coarse_x);
+                    this->prolongations[level].product(coarse_x, t);
+
+                    for(std::size_t j = 0; j < size; ++j)
+                        x[j] += t[j];
+
+                    // Post-smoothing.
+                    this->smooth(level, b, x);
+                }
+
+            public:
+
+                // CONSTRUCTORS.
+
+                /**
+                 * @brief Builds the hierarchy for a compressed Matrix<T, Row>.
+                 *
+                 * @param matrix
+                 * @param smoother
+                 * @param sweeps Smoothing sweeps, or Chebyshev degree.
+                 * @param theta Strength of connection threshold.
+                 * @param coarse Maximum coarsest size, solved directly, larger coarsest levels are smoothed.
+                 */
+                AMG(const Matrix<T, Row> &matrix, const Smoother &smoother = Jacobi, const std::size_t &sweeps = 2, const double &theta = 0.08, const std::size_t &coarse = 64):
+                smoother{smoother}, sweeps{sweeps} {
+                    #ifndef NDEBUG
+                    assert(matrix.is_compressed());
+                    assert(matrix.rows() == matrix.columns());
+                    assert(sweeps > 0);
+                    #endif
+
+                    this->operators.emplace_back(matrix);
+                    this->operators.back().expand();
+
+                    while(this->operators.back().rows() > coarse) {
+                        const Matrix<T, Row> &fine = this->operators.back();
+                        const std::size_t size = fine.rows();
+
+                        this->diagonals.emplace_back(inverse_diagonal(fine));
+                        this->radii.emplace_back(radius(fine, this->diagonals.back()));
+
+                        // Aggregation.
+                        std::vector<std::size_t> aggregates;
+                        const std::size_t count = aggregate(fine, this->diagonals.back(), theta, aggregates);
+
+                        if(static_cast<double>(count) > COARSENING_PACS * static_cast<double>(size)) // Stagnation, smoothed coarsest level.
+                            break;
+
+                        // Tentative prolongation, normalized piecewise constants.
+                        std::vector<std::size_t> inner, sizes;
+                        std::vector<T> values;
+                        inner.resize(size + 1);
+                        sizes.resize(count, 0);
+                        values.resize(size);
+
+                        std::iota(inner.begin(), inner.end(), 0);
+
+                        for(const auto &index: aggregates)
+                            ++sizes[index];
+
+                        for(std::size_t j = 0; j < size; ++j)
+                            values[j] = static_cast<T>(1.0 / std::sqrt(static_cast<double>(sizes[aggregates[j]])));
+
+                        Matrix<T, Row> tentative{size, count, inner, aggregates, values};
+
+                        // Smoothed prolongation, P = (I - omega D^{-1} A) T.
+                        Matrix<T, Row> product = fine * tentative;
+                        std::vector<T> scaled(product.get_values().begin(), product.get_values().end());
+                        const auto &product_inner = product.get_inner();
+                        const double omega = 4.0 / (3.0 * this->radii.back());
+
+                        for(std::size_t j = 0; j < size; ++j) {
+                            for(std::size_t k = product_inner[j]; k < product_inner[j + 1]; ++k)
+                                scaled[k] *= static_cast<T>(omega) * this->diagonals.back()[j];
+                        }
+
+                        Matrix<T, Row> smoothed{size, count, product_inner, product.get_outer(), scaled};
+                        this->prolongations.emplace_back(tentative - smoothed);
+                        this->restrictions.emplace_back(this->prolongations.back().transpose());
+
+                        // Galerkin coarse operator, R A P.
+                        this->operators.emplace_back(this->restrictions.back() * (fine * this->prolongations.back()));
+                    }
+
+                    // Coarsest level, factorized if small enough.
+                    if(this->operators.back().rows() <= coarse)
+                        this->factorize();
+                    this->work.resize(this->operators.size());
+                }
+
+                // APPLICATION.
+
+                /**
+                 * @brief Applies one V-cycle, z = M^{-1} r.
+                 *
+                 * @param residual
+                 * @param result
+                 */
+                void apply(const std::vector<T> &residual, std::vector<T> &result) const {
+                    this->cycle(0, residual, result);
+                }
+
+                // HIERARCHY.
+
+                /**
+                 * @brief Returns the number of levels.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t depth() const {
+                    return this->operators.size();
+                }
+
+                /**
+                 * @brief Returns the operator complexity, total non zero elements over the finest ones.
+                 *
+                 * @return double
+                 */
+                double complexity() const {
+                    double total = 0.0;
+
+                    for(const auto &matrix: this->operators)
+                        total += static_cast<double>(matrix.size());
+
+                    return total / static_cast<double>(this->operators.front().size());
+                }
+        };
+
+    }
+
+}
+
+#endif
@@ -0,0 +1,285 @@
+/**
+ * @file Packed.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-05-04
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef PACKED_PACS
+#define PACKED_PACS
+
+// Type.
+#include <Type.hpp>
+
+// Matrix.
+#include <Matrix.hpp>
+
+// First-touch storage.
+#include <Memory.hpp>
+
+// Thread pool.
+#ifdef PARALLEL_PACS
+#include <Pool.hpp>
+#endif
+
+// Containers.
+#include <vector>
+#include <array>
+
+// Assertions.
+#include <cassert>
+
+// Algorithms.
+#include <algorithm>
+#include <numeric>
+
+// Bytes.
+#include <cstdint>
+#include <cstring>
+
+// Rows per segment, sharing a base column and an offsets' width.
+#ifndef SEGMENT_PACS
+#define SEGMENT_PACS 8
+#endif
+
+namespace pacs {
+
+    namespace algebra {
+
+        /**
+         * @brief Index-compressed CSR: rows are grouped into segments of SEGMENT_PACS rows, each storing its smallest column and its rows' columns' offsets from it, in 1, 2, 4 or 8 bytes, whichever fits the segment's span.
+         * Rows keep only their values' offsets, CSR's inner, as their offsets' bytes follow from it within their segment.
+         * Offsets, unlike chained deltas, decode independently, so that the product's inner loops vectorize.
+         * Built from a compressed Matrix, symmetric storage is expanded and Column order transposed, so that the product always runs on rows.
+         *
+         * @tparam T
+         * @tparam O Source Matrix' ordering.
+         */
+        template<MatrixType T, Order O = Row>
+        class Packed {
+            private:
+
+                std::size_t height, width;
+
+                // Values' offsets, CSR's inner.
+                Vector<std::size_t> inner;
+
+                // Segments' smallest columns, offsets' first bytes and offsets' widths, in bytes.
+                Vector<std::size_t> bases;
+                Vector<std::size_t> starts;
+                Vector<std::uint8_t> widths;
+
+                // Columns' offsets, each segment aligned to its width.
+                Vector<std::uint8_t> offsets;
+                Vector<T> values;
+
+                /**
+                 * @brief Writes a segment's rows' dot products with vector into result, decoding W bytes wide offsets.
+                 *
+                 * @tparam W
+                 * @param s
+                 * @param vector
+                 * @param result
+                 */
+                template<typename W>
+                void segment(const std::size_t &s, const std::vector<T> &vector, std::vector<T> &result) const {
+                    const std::size_t first = s * SEGMENT_PACS, last = std::min(first + SEGMENT_PACS, this->height);
+
+                    const std::uint8_t *bytes = this->offsets.data() + this->starts[s];
+                    const T *shifted = vector.data() + this->bases[s];
+                    const std::size_t origin = this->inner[first];
+
+                    for(std::size_t j = first; j < last; ++j) {
+                        T sum = static_cast<T>(0);
+
+                        for(std::size_t k = this->inner[j]; k < this->inner[j + 1]; ++k) {
+                            W offset;
+                            std::memcpy(&offset, bytes + (k - origin) * sizeof(W), sizeof(W));
+
+                            sum += this->values[k] * shifted[offset];
+                        }
+
+                        result[j] = sum;
+                    }
+                }
+
+            public:
+
+                // CONSTRUCTORS.
+
+                /**
+                 * @brief Packs a compressed Matrix' indices.
+                 *
+                 * @param matrix
+                 */
+                Packed(const Matrix<T, O> &matrix): height{matrix.rows()}, width{matrix.columns()} {
+                    #ifndef NDEBUG
+                    assert(matrix.is_compressed());
+                    #endif
+
+                    Vector<std::size_t> columns;
+                    rows_of(matrix, this->inner, columns, this->values);
+
+                    const std::size_t segments = (this->height + SEGMENT_PACS - 1) / SEGMENT_PACS;
+
+                    // Widths, by span.
+                    this->bases.resize(segments);
+                    this->widths.resize(segments);
+                    this->starts.assign(segments + 1, 0);
+
+                    each(segments, [this, &columns](const std::size_t &s) {
+                        const std::size_t first = s * SEGMENT_PACS, last = std::min(first + SEGMENT_PACS, this->height);
+                        std::size_t lowest = static_cast<std::size_t>(-1), highest = 0;
+
+                        // Sorted rows, extremes only.
+                        for(std::size_t j = first; j < last; ++j) {
+                            if(this->inner[j] < this->inner[j + 1]) {
+                                lowest = std::min(lowest, columns[this->inner[j]]);
+                                highest = std::max(highest, columns[this->inner[j + 1] - 1]);
+                            }
+                        }
+
+                        const bool empty = lowest > highest;
+                        const std::size_t span = empty ? 0 : highest - lowest;
+
+                        this->bases[s] = empty ? 0 : lowest;
+                        this->widths[s] = span <= 0xFF ? 1 : (span <= 0xFFFF ? 2 : (span <= 0xFFFFFFFF ? 4 : 8));
+                    });
+
+                    // Starts, each rounded up to its segment's width.
+                    for(std::size_t s = 0; s < segments; ++s) {
+                        const std::size_t first = s * SEGMENT_PACS, last = std::min(first + SEGMENT_PACS, this->height);
+                        const std::size_t start = (this->starts[s] + this->widths[s] - 1) / this->widths[s] * this->widths[s];
+
+                        this->starts[s] = start;
+                        this->starts[s + 1] = start + (this->inner[last] - this->inner[first]) * this->widths[s];
+                    }
+
+                    this->offsets.resize(this->starts[segments]);
+
+                    // First touch under the product's partition.
+                    each(segments, [this, &columns](const std::size_t &s) {
+                        const std::size_t first = s * SEGMENT_PACS, last = std::min(first + SEGMENT_PACS, this->height);
+                        const std::size_t length = this->inner[last] - this->inner[first];
+                        std::uint8_t *bytes = this->offsets.data() + this->starts[s];
+
+                        std::fill(bytes, bytes + length * this->widths[s], static_cast<std::uint8_t>(0));
+
+                        if(s + 1 < this->widths.size())
+                            std::fill(bytes + length * this->widths[s], this->offsets.data() + this->starts[s + 1], static_cast<std::uint8_t>(0));
+
+                        for(std::size_t k = 0; k < length; ++k) {
+                            const std::uint64_t offset = columns[this->inner[first] + k] - this->bases[s];
+
+                            switch(this->widths[s]) {
+                                case 1: { const std::uint8_t narrow = static_cast<std::uint8_t>(offset); std::memcpy(bytes + k, &narrow, 1); break; }
+                                case 2: { const std::uint16_t narrow = static_cast<std::uint16_t>(offset); std::memcpy(bytes + 2 * k, &narrow, 2); break; }
+                                case 4: { const std::uint32_t narrow = static_cast<std::uint32_t>(offset); std::memcpy(bytes + 4 * k, &narrow, 4); break; }
+                                default: std::memcpy(bytes + 8 * k, &offset, 8);
+                            }
+                        }
+                    });
+                }
+
+                // PRODUCT.
+
+                /**
+                 * @brief Writes the product of Matrix x Vector into result, reusing its storage.
+                 *
+                 * @param vector
+                 * @param result
+                 */
+                void product(const std::vector<T> &vector, std::vector<T> &result) const {
+                    #ifndef NDEBUG
+                    assert(vector.size() == this->width);
+                    assert(&vector != &result);
+                    #endif
+
+                    result.resize(this->height);
+
+                    each(this->widths.size(), [this, &vector, &result](const std::size_t &s) {
+                        switch(this->widths[s]) {
+                            case 1: this->template segment<std::uint8_t>(s, vector, result); break;
+                            case 2: this->template segment<std::uint16_t>(s, vector, result); break;
+                            case 4: this->template segment<std::uint32_t>(s, vector, result); break;
+                            default: this->template segment<std::uint64_t>(s, vector, result);
+                        }
+                    });
+                }
+
+                /**
+                 * @brief Returns the product of Matrix x Vector.
+                 *
+                 * @param vector
+                 * @return std::vector<T>
+                 */
+                std::vector<T> operator *(const std::vector<T> &vector) const {
+                    std::vector<T> result;
+                    this->product(vector, result);
+
+                    return result;
+                }
+
+                // INFO.
+
+                /**
+                 * @brief Returns the number of rows.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t rows() const {
+                    return this->height;
+                }
+
+                /**
+                 * @brief Returns the number of columns.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t columns() const {
+                    return this->width;
+                }
+
+                /**
+                 * @brief Returns the number of stored elements.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t size() const {
+                    return this->values.size();
+                }
+
+                /**
+                 * @brief Returns the indices' bytes: offsets, bases, starts, widths and inner.
+                 *
+                 * @return std::size_t
+                 */
+                std::size_t index_bytes() const {
+                    return this->offsets.size() + this->widths.size() + (this->bases.size() + this->starts.size() + this->inner.size()) * sizeof(std::size_t);
+                }
+
+                /**
+                 * @brief Returns the rows' count per offsets' width: 1, 2, 4 and 8 bytes.
+                 *
+                 * @return std::array<std::size_t, 4>
+                 */
+                std::array<std::size_t, 4> histogram() const {
+                    std::array<std::size_t, 4> counts{};
+
+                    for(std::size_t s = 0; s < this->widths.size(); ++s) {
+                        const std::size_t rows = std::min((s + 1) * SEGMENT_PACS, this->height) - s * SEGMENT_PACS;
+                        counts[this->widths[s] == 1 ? 0 : (this->widths[s] == 2 ? 1 : (this->widths[s] == 4 ? 2 : 3))] += rows;
+                    }
+
+                    return counts;
+                }
+        };
+
+    }
+
+}
+
+#endif
@@ -0,0 +1,444 @@
+/**
+ * @file Pool.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-04-28
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef POOL_PACS
+#define POOL_PACS
+
+// Containers.
+#include <vector>
+#include <deque>
+
+// Concurrency.
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <future>
+
+// Utilities.
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <chrono>
+#include <cstdlib>
+
+// Algorithms.
+#include <algorithm>
+
+// Instrumentation.
+#ifdef PROFILING_PACS
+#include <Counters.hpp>
+#endif
+
+// Affinity.
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Chunks per thread for parallel loops.
+#ifndef CHUNKS_PACS
+#define CHUNKS_PACS 4
+#endif
+
+namespace pacs {
+
+    namespace algebra {
+
+        /**
+         * @brief Persistent work-stealing thread pool.
+         * Each worker owns a deque, popping its own tasks from the back and stealing others' from the front.
+         * Waiting threads run pending tasks instead of blocking, so nested parallel calls are safe.
+         * The calling thread takes part in every parallel loop, a pool of n threads owns n - 1 workers.
+         *
+         */
+        class Pool {
+            private:
+
+                // Workers' deques.
+                struct Queue {
+                    std::mutex mutex;
+                    std::deque<std::function<void ()>> tasks;
+                };
+
+                std::vector<std::thread> workers;
+                std::vector<std::unique_ptr<Queue>> queues;
+
+                // Sleeping workers.
+                std::mutex mutex;
+                std::condition_variable condition;
+                std::atomic<std::size_t> pending{0};
+                bool stop = false;
+
+                // Configuration.
+                std::size_t count = 1;
+                bool pinned = false;
+
+                // Round-robin queue for external threads.
+                std::atomic<std::size_t> next{0};
+
+                // Worker's index, none for external threads.
+                static inline thread_local std::size_t identifier = static_cast<std::size_t>(-1);
+
+                // HELPERS.
+
+                /**
+                 * @brief Pins the calling thread to a CPU.
+                 *
+                 * @param cpu
+                 */
+                static void pin(const std::size_t &cpu) {
+                    #ifdef __linux__
+                    cpu_set_t set;
+                    CPU_ZERO(&set);
+                    CPU_SET(cpu % std::max(1u, std::thread::hardware_concurrency()), &set);
+                    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+                    #endif
+                }
+
+                /**
+                 * @brief Queues a task, on the caller's own deque when it is a worker.
+                 *
+                 * @param task
+                 * @param queue Preferred deque.
+                 */
+                void push(std::function<void ()> task, const std::size_t &queue) {
+                    Queue &target = *(this->queues[queue % this->queues.size()]);
+
+                    {
+                        std::lock_guard<std::mutex> lock{target.mutex};
+                        target.tasks.emplace_back(std::move(task));
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lock{this->mutex};
+                        ++this->pending;
+                    }
+
+                    this->condition.notify_one();
+                }
+
+                /**
+                 * @brief Runs one pending task, if any: own deque's back first, then others' fronts.
+                 *
+                 * @return true
+                 * @return false
+                 */
+                bool run() {
+                    const std::size_t size = this->queues.size();
+                    const std::size_t start = identifier < size ? identifier : 0;
+                    std::function<void ()> task;
+
+                    for(std::size_t j = 0; (j < size) && !(task); ++j) {
+                        Queue &queue = *(this->queues[(start + j) % size]);
+                        std::lock_guard<std::mutex> lock{queue.mutex};
+
+                        if(queue.tasks.empty())
+                            continue;
+
+                        if((j == 0) && (identifier < size)) {
+                            task = std::move(queue.tasks.back());
+                            queue.tasks.pop_back();
+                        } else {
+                            task = std::move(queue.tasks.front());
+                            queue.tasks.pop_front();
+                        }
+                    }
+
+                    if(!(task))
+                        return false;
+
+                    --this->pending;
+                    task();
+
+                    return true;
+                }
+
+                /**
+                 * @brief Worker's loop.
+                 *
+                 * @param index
+                 */
+                void work(const std::size_t &index) {
+                    identifier = index;
+
+                    if(this->pinned)
+                        pin(index + 1);
+
+                    while(true) {
+                        if(this->run())
+                            continue;
+
+                        std::unique_lock<std::mutex> lock{this->mutex};
+                        this->condition.wait(lock, [this]() { return this->stop || (this->pending.load() > 0); });
+
+                        if(this->stop && (this->pending.load() == 0))
+                            return;
+                    }
+                }
+
+                /**
+                 * @brief Starts the workers.
+                 *
+                 */
+                void start() {
+                    this->stop = false;
+
+                    for(std::size_t j = 0; j + 1 < this->count; ++j)
+                        this->queues.emplace_back(std::make_unique<Queue>());
+
+                    for(std::size_t j = 0; j + 1 < this->count; ++j)
+                        this->workers.emplace_back(&Pool::work, this, j);
+
+                    if(this->pinned)
+                        pin(0);
+                }
+
+                /**
+                 * @brief Joins the workers.
+                 *
+                 */
+                void halt() {
+                    {
+                        std::lock_guard<std::mutex> lock{this->mutex};
+                        this->stop = true;
+                    }
+
+                    this->condition.notify_all();
+
+                    for(auto &worker: this->workers)
+                        worker.join();
+
+                    this->workers.clear();
+                    this->queues.clear();
+                }
+
+                // CONSTRUCTORS.
+
+                /**
+                 * @brief Reads the PACS_THREADS and PACS_PIN environment variables, defaults to every hardware thread, unpinned.
+                 *
+                 */
+                Pool() {
+                    const char *threads = std::getenv("PACS_THREADS");
+                    const char *pinned = std::getenv("PACS_PIN");
+
+                    this->count = threads ? std::strtoul(threads, nullptr, 10) : std::thread::hardware_concurrency();
+                    this->count = std::max(this->count, static_cast<std::size_t>(1));
+                    this->pinned = pinned && (std::atoi(pinned) != 0);
+
+                    this->start();
+                }
+
+            public:
+
+                Pool(const Pool &) = delete;
+                Pool &operator =(const Pool &) = delete;
+
+                ~Pool() {
+                    this->halt();
+                }
+
+                /**
+                 * @brief Returns the library's pool.
+                 *
+                 * @return Pool&
+                 */
+                static Pool &instance() {
+                    static Pool pool;
+                    return pool;
+                }
+
+                // CONFIGURATION.
+
+                /**
+                 * @brief Restarts the pool with a given number of threads, caller included.
+                 * Pinning binds the caller to CPU 0 and the j-th worker to CPU j + 1. Not to be called while parallel work is running.
+                 *
+                 * @param threads
+                 * @param pinned
+                 */
+                void configure(const std::size_t &threads, const bool &pinned = false) {
+                    this->halt();
+
+                    this->count = std::max(threads, static_cast<std::size_t>(1));
+                    this->pinned = pinned;
+
+                    this->start();
+                }
+
+                /**
+                 * @brief Returns the number of threads, caller included.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t threads() const {
+                    return this->count;
+                }
+
+                /**
+                 * @brief Returns the pinning state.
+                 *
+                 * @return true
+                 * @return false
+                 */
+                inline bool is_pinned() const {
+                    return this->pinned;
+                }
+
+                // PARALLELISM.
+
+                /**
+                 * @brief Applies a function to every index in [0, size).
+                 * The range is split into contiguous chunks, the j-th chunk is queued on the j-th deque and may be stolen.
+                 *
+                 * @param size
+                 * @param function
+                 */
+                void parallel(const std::size_t &size, const auto &function) {
+                    const std::size_t chunks = std::min(size, this->count * CHUNKS_PACS);
+
+                    if(this->workers.empty() || (chunks <= 1)) {
+                        for(std::size_t j = 0; j < size; ++j)
+                            function(j);
+
+                        return;
+                    }
+
+                    std::atomic<std::size_t> remaining{chunks - 1};
+
+                    auto range = [&size, &chunks, &function](const std::size_t &c) {
+                        for(std::size_t j = c * size / chunks; j < (c + 1) * size / chunks; ++j)
+                            function(j);
+                    };
+
+                    // Chunks count towards the caller's probe.
+                    #ifdef PROFILING_PACS
+                    auto chunk = [&range, probe = Probe::active()](const std::size_t &c) {
+                        Probe::Scope scope{probe};
+                        range(c);
+                    };
+                    #else
+                    auto &chunk = range;
+                    #endif
+
+                    for(std::size_t c = 1; c < chunks; ++c) {
+                        this->push([&chunk, &remaining, c]() {
+                            chunk(c);
+                            remaining.fetch_sub(1, std::memory_order_release);
+                        }, c - 1);
+                    }
+
+                    chunk(0);
+
+                    // Helps while waiting.
+                    while(remaining.load(std::memory_order_acquire) > 0) {
+                        if(!(this->run()))
+                            std::this_thread::yield();
+                    }
+                }
+
+                /**
+                 * @brief Returns the reduction of map(j) for j in [0, size) through combine.
+                 * Partial results are combined in chunks' order.
+                 *
+                 * @tparam V
+                 * @param size
+                 * @param identity
+                 * @param map
+                 * @param combine
+                 * @return V
+                 */
+                template<typename V>
+                V reduce(const std::size_t &size, const V &identity, const auto &map, const auto &combine) {
+                    const std::size_t chunks = std::max(std::min(size, this->count * CHUNKS_PACS), static_cast<std::size_t>(1));
+
+                    std::vector<V> partials;
+                    partials.resize(chunks, identity);
+
+                    this->parallel(chunks, [&](const std::size_t &c) {
+                        V partial = identity;
+
+                        for(std::size_t j = c * size / chunks; j < (c + 1) * size / chunks; ++j)
+                            partial = combine(partial, map(j));
+
+                        partials[c] = partial;
+                    });
+
+                    V result = identity;
+
+                    for(const auto &partial: partials)
+                        result = combine(result, partial);
+
+                    return result;
+                }
+
+                /**
+                 * @brief Runs a function asynchronously, inline when the pool has no workers.
+                 *
+                 * @tparam F
+                 * @param function
+                 * @return std::future<std::invoke_result_t<F>>
+                 */
+                template<typename F>
+                std::future<std::invoke_result_t<F>> async(F function) {
+                    using R = std::invoke_result_t<F>;
+
+                    auto task = std::make_shared<std::packaged_task<R ()>>(std::move(function));
+                    std::future<R> future = task->get_future();
+
+                    if(this->workers.empty())
+                        (*task)();
+                    else
+                        this->push([task]() { (*task)(); }, identifier < this->queues.size() ? identifier : this->next++);
+
+                    return future;
+                }
+
+                /**
+                 * @brief Waits for a future, running pending tasks meanwhile.
+                 *
+                 * @tparam R
+                 * @param future
+                 * @return R
+                 */
+                template<typename R>
+                R await(std::future<R> &future) {
+                    while(future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+                        if(!(this->run()))
+                            std::this_thread::yield();
+                    }
+
+                    return future.get();
+                }
+        };
+
+        // HELPERS.
+
+        /**
+         * @brief Applies a function to every index in [0, size), in parallel when enabled.
+         *
+         * @param size
+         * @param function
+         */
+        inline void each(const std::size_t &size, const auto &function) {
+            #ifdef PARALLEL_PACS
+            Pool::instance().parallel(size, function);
+            #else
+            for(std::size_t j = 0; j < size; ++j)
+                function(j);
+            #endif
+        }
+
+    }
+
+}
+
+#endif
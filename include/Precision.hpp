@@ -0,0 +1,298 @@
+/**
+ * @file Precision.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-05-03
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef PRECISION_PACS
+#define PRECISION_PACS
+
+// Type.
+#include <Type.hpp>
+
+// Matrix.
+#include <Matrix.hpp>
+
+// First-touch storage.
+#include <Memory.hpp>
+
+// Thread pool.
+#ifdef PARALLEL_PACS
+#include <Pool.hpp>
+#endif
+
+// Containers.
+#include <vector>
+
+// Assertions.
+#include <cassert>
+
+// Concepts.
+#include <concepts>
+#include <type_traits>
+
+// Algorithms.
+#include <algorithm>
+#include <numeric>
+
+// Bits.
+#include <bit>
+#include <cstdint>
+
+// Math.
+#include <cmath>
+
+namespace pacs {
+
+    namespace algebra {
+
+        // Narrow storage types.
+
+        /**
+         * @brief bfloat16, float's upper half: 8 exponent bits and 7 mantissa bits. Conversions round to nearest even.
+         *
+         */
+        struct BFloat16 {
+            std::uint16_t bits; // Uninitialized by default, for first touch.
+
+            BFloat16() = default;
+
+            explicit BFloat16(const float &value) {
+                const std::uint32_t word = std::bit_cast<std::uint32_t>(value);
+
+                if(std::isnan(value)) {
+                    this->bits = static_cast<std::uint16_t>((word >> 16) | 0x0040);
+                    return;
+                }
+
+                this->bits = static_cast<std::uint16_t>((word + 0x7FFF + ((word >> 16) & 1)) >> 16);
+            }
+
+            operator float() const {
+                return std::bit_cast<float>(static_cast<std::uint32_t>(this->bits) << 16);
+            }
+        };
+
+        /**
+         * @brief IEEE 754 binary16, emulated: 5 exponent bits and 10 mantissa bits, with subnormals. Conversions round to nearest even.
+         *
+         */
+        struct Half {
+            std::uint16_t bits; // Uninitialized by default, for first touch.
+
+            Half() = default;
+
+            explicit Half(const float &value) {
+                const std::uint32_t word = std::bit_cast<std::uint32_t>(value);
+                const std::uint16_t sign = static_cast<std::uint16_t>((word >> 16) & 0x8000);
+                const std::uint32_t magnitude = word & 0x7FFFFFFF;
+
+                // Infinities and NaNs.
+                if(magnitude >= 0x7F800000) {
+                    this->bits = sign | (magnitude > 0x7F800000 ? 0x7E00 : 0x7C00);
+                    return;
+                }
+
+                // Overflow, from 65520 on.
+                if(magnitude >= 0x477FF000) {
+                    this->bits = sign | 0x7C00;
+                    return;
+                }
+
+                // Subnormals, in units of 2^-24; exact scaling, rounded to nearest even.
+                if(magnitude < 0x38800000) {
+                    this->bits = sign | static_cast<std::uint16_t>(std::nearbyint(std::bit_cast<float>(magnitude) * 16777216.0f));
+                    return;
+                }
+
+                // Normals, rebiased.
+                const std::uint32_t rebiased = magnitude - 0x38000000;
+                this->bits = sign | static_cast<std::uint16_t>((rebiased + 0x0FFF + ((rebiased >> 13) & 1)) >> 13);
+            }
+
+            operator float() const {
+                const std::uint32_t sign = static_cast<std::uint32_t>(this->bits & 0x8000) << 16;
+                const std::uint32_t exponent = (this->bits >> 10) & 0x1F;
+                const std::uint32_t mantissa = this->bits & 0x03FF;
+
+                if(exponent == 0) // Zeros and subnormals.
+                    return sign ? -std::ldexp(static_cast<float>(mantissa), -24) : std::ldexp(static_cast<float>(mantissa), -24);
+
+                if(exponent == 0x1F) // Infinities and NaNs.
+                    return std::bit_cast<float>(sign | 0x7F800000 | (mantissa << 13));
+
+                return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+            }
+        };
+
+        /**
+         * @brief Values' storage types: float or narrower.
+         *
+         * @tparam S
+         */
+        template<typename S>
+        concept Narrow = std::same_as<S, float> || std::same_as<S, BFloat16> || std::same_as<S, Half>;
+
+        /**
+         * @brief Compressed Matrix storing its values in a narrower type, accumulating in double.
+         * Built from a full precision compressed Matrix, symmetric storage is expanded and Column order transposed, so that the product always runs on rows.
+         *
+         * @tparam T Vectors' type.
+         * @tparam S Values' storage type.
+         * @tparam O Source Matrix' ordering.
+         */
+        template<std::floating_point T, Narrow S, Order O = Row>
+        class Mixed {
+            private:
+
+                std::size_t height, width;
+
+                // CSR.
+                Vector<std::size_t> inner;
+                Vector<std::size_t> outer;
+                Vector<S> values;
+
+            public:
+
+                // CONSTRUCTORS.
+
+                /**
+                 * @brief Narrows a compressed Matrix.
+                 *
+                 * @param matrix
+                 */
+                Mixed(const Matrix<T, O> &matrix): height{matrix.rows()}, width{matrix.columns()} {
+                    #ifndef NDEBUG
+                    assert(matrix.is_compressed());
+                    #endif
+
+                    Vector<T> wide;
+                    rows_of(matrix, this->inner, this->outer, wide);
+
+                    this->values.resize(wide.size());
+
+                    // First touch under the product's partition.
+                    each(this->height, [this, &wide](const std::size_t &j) {
+                        for(std::size_t k = this->inner[j]; k < this->inner[j + 1]; ++k)
+                            this->values[k] = S(static_cast<float>(wide[k]));
+                    });
+                }
+
+                // PRODUCT.
+
+                /**
+                 * @brief Writes the product of Matrix x Vector into result, reusing its storage. Rows accumulate in double.
+                 *
+                 * @param vector
+                 * @param result
+                 */
+                void product(const std::vector<T> &vector, std::vector<T> &result) const {
+                    #ifndef NDEBUG
+                    assert(vector.size() == this->width);
+                    assert(&vector != &result);
+                    #endif
+
+                    result.resize(this->height);
+
+                    each(this->height, [this, &vector, &result](const std::size_t &j) {
+                        double sum = 0.0;
+
+                        for(std::size_t k = this->inner[j]; k < this->inner[j + 1]; ++k)
+                            sum += static_cast<double>(static_cast<float>(this->values[k])) * static_cast<double>(vector[this->outer[k]]);
+
+                        result[j] = static_cast<T>(sum);
+                    });
+                }
+
+                /**
+                 * @brief Returns the product of Matrix x Vector.
+                 *
+                 * @param vector
+                 * @return std::vector<T>
+                 */
+                std::vector<T> operator *(const std::vector<T> &vector) const {
+                    std::vector<T> result;
+                    this->product(vector, result);
+
+                    return result;
+                }
+
+                // NORMS.
+
+                /**
+                 * @brief Returns the stored values' norms and rows' statistics, accumulated in double.
+                 *
+                 * @return Norms
+                 */
+                Norms norms() const {
+                    Norms norms;
+                    std::vector<double> columns;
+                    columns.resize(this->width, 0.0);
+
+                    norms.nonzeros = this->values.size();
+                    norms.shortest = this->height > 0 ? static_cast<std::size_t>(-1) : 0;
+
+                    for(std::size_t j = 0; j < this->height; ++j) {
+                        double row = 0.0;
+
+                        for(std::size_t k = this->inner[j]; k < this->inner[j + 1]; ++k) {
+                            const double value = std::abs(static_cast<double>(static_cast<float>(this->values[k])));
+
+                            row += value;
+                            columns[this->outer[k]] += value;
+
+                            norms.frobenius += value * value;
+                            norms.maximum = std::max(norms.maximum, value);
+                        }
+
+                        norms.infinity = std::max(norms.infinity, row);
+                        norms.shortest = std::min(norms.shortest, this->inner[j + 1] - this->inner[j]);
+                        norms.longest = std::max(norms.longest, this->inner[j + 1] - this->inner[j]);
+                    }
+
+                    norms.one = columns.empty() ? 0.0 : std::ranges::max(columns);
+                    norms.frobenius = std::sqrt(norms.frobenius);
+                    norms.mean = this->height > 0 ? static_cast<double>(norms.nonzeros) / static_cast<double>(this->height) : 0.0;
+
+                    return norms;
+                }
+
+                // INFO.
+
+                /**
+                 * @brief Returns the number of rows.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t rows() const {
+                    return this->height;
+                }
+
+                /**
+                 * @brief Returns the number of columns.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t columns() const {
+                    return this->width;
+                }
+
+                /**
+                 * @brief Returns the number of stored elements.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t size() const {
+                    return this->values.size();
+                }
+        };
+
+    }
+
+}
+
+#endif
@@ -0,0 +1,379 @@
+/**
+ * @file Preconditioners.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-04-24
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef PRECONDITIONERS_PACS
+#define PRECONDITIONERS_PACS
+
+// Type.
+#include <Type.hpp>
+
+// Matrix.
+#include <Matrix.hpp>
+
+// Solvers.
+#include <Solvers.hpp>
+
+// Containers.
+#include <vector>
+#include <array>
+
+// Assertions.
+#include <cassert>
+
+// Algorithms.
+#include <algorithm>
+#include <numeric>
+
+// Thread pool.
+#include <Pool.hpp>
+
+// Math.
+#include <cmath>
+#include <complex>
+
+// Minimum level size for parallel sweeps.
+#ifndef LEVEL_PACS
+#define LEVEL_PACS 256
+#endif
+
+namespace pacs {
+
+    namespace algebra {
+
+        /**
+         * @brief Level schedule for a sparse triangular sweep.
+         * Rows sharing a level only depend on rows from previous levels.
+         *
+         */
+        class Schedule {
+            private:
+
+                // Rows, level by level.
+                std::vector<std::size_t> order;
+
+                // Levels' offsets into order.
+                std::vector<std::size_t> levels;
+
+            public:
+
+                // CONSTRUCTORS.
+
+                Schedule() = default;
+
+                /**
+                 * @brief Builds the schedule of a triangular part of a compressed pattern.
+                 *
+                 * @param inner
+                 * @param outer
+                 * @param diagonal Diagonal positions.
+                 * @param lower Lower (forward) or upper (backward) part.
+                 */
+                Schedule(const std::vector<std::size_t> &inner, const std::vector<std::size_t> &outer, const std::vector<std::size_t> &diagonal, const bool &lower) {
+                    const std::size_t size = diagonal.size();
+
+                    std::vector<std::size_t> level;
+                    level.resize(size, 0);
+
+                    // Dependency DAG depth.
+                    std::size_t depth = 0;
+
+                    for(std::size_t h = 0; h < size; ++h) {
+                        const std::size_t j = lower ? h : size - 1 - h;
+                        const std::size_t start = lower ? inner[j] : diagonal[j] + 1;
+                        const std::size_t end = lower ? diagonal[j] : inner[j + 1];
+
+                        for(std::size_t k = start; k < end; ++k)
+                            level[j] = std::max(level[j], level[outer[k]] + 1);
+
+                        depth = std::max(depth, level[j] + 1);
+                    }
+
+                    // Counting sort by level.
+                    this->levels.resize(depth + 1, 0);
+
+                    for(const auto &value: level)
+                        ++this->levels[value + 1];
+
+                    std::inclusive_scan(this->levels.begin(), this->levels.end(), this->levels.begin());
+
+                    std::vector<std::size_t> position{this->levels.begin(), this->levels.end() - 1};
+                    this->order.resize(size);
+
+                    for(std::size_t h = 0; h < size; ++h) {
+                        const std::size_t j = lower ? h : size - 1 - h;
+                        this->order[position[level[j]]++] = j;
+                    }
+                }
+
+                // SWEEP.
+
+                /**
+                 * @brief Applies a function to every row, level by level.
+                 *
+                 * @param function
+                 */
+                void sweep(const auto &function) const {
+                    for(std::size_t l = 0; l < this->depth(); ++l) {
+                        const auto start = this->order.begin() + this->levels[l];
+                        const auto end = this->order.begin() + this->levels[l + 1];
+
+                        #ifdef PARALLEL_PACS
+                        if(end - start >= LEVEL_PACS) {
+                            Pool::instance().parallel(end - start, [&start, &function](const std::size_t &j) { function(start[j]); });
+                            continue;
+                        }
+                        #endif
+
+                        std::for_each(start, end, function);
+                    }
+                }
+
+                /**
+                 * @brief Returns the number of levels.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t depth() const {
+                    return this->levels.size() - 1;
+                }
+        };
+
+        /**
+         * @brief Incomplete factorization sharing the pattern of a compressed Matrix<T, Row>.
+         * The strictly lower part holds L, the upper part, diagonal included, holds U.
+         *
+         * @tparam T
+         */
+        template<MatrixType T>
+        class Factorization {
+            protected:
+
+                // Pattern.
+                std::vector<std::size_t> inner;
+                std::vector<std::size_t> outer;
+                std::vector<std::size_t> diagonal;
+
+                // Factors.
+                std::vector<T> values;
+
+                // Unit lower factor.
+                bool unit;
+
+                // Cached schedules.
+                Schedule forward;
+                Schedule backward;
+
+                /**
+                 * @brief Copies the pattern, expanding symmetric storage, and locates the diagonal.
+                 *
+                 * @param matrix
+                 * @param unit
+                 */
+                Factorization(const Matrix<T, Row> &matrix, const bool &unit): unit{unit} {
+                    #ifndef NDEBUG
+                    assert(matrix.rows() == matrix.columns());
+                    #endif
+
+                    auto copy = [this](const Matrix<T, Row> &general) {
+                        this->inner.assign(general.get_inner().begin(), general.get_inner().end());
+                        this->outer.assign(general.get_outer().begin(), general.get_outer().end());
+                        this->values.assign(general.get_values().begin(), general.get_values().end());
+                    };
+
+                    // General storage.
+                    if(matrix.is_symmetric()) {
+                        Matrix<T, Row> expanded = matrix;
+                        expanded.expand();
+
+                        copy(expanded);
+                    } else
+                        copy(matrix);
+
+                    this->diagonal.resize(matrix.rows());
+
+                    for(std::size_t j = 0; j < matrix.rows(); ++j) {
+                        auto position = std::lower_bound(this->outer.begin() + this->inner[j], this->outer.begin() + this->inner[j + 1], j);
+
+                        #ifndef NDEBUG // Structurally non-singular diagonal.
+                        assert((position != this->outer.begin() + this->inner[j + 1]) && (*position == j));
+                        #endif
+
+                        this->diagonal[j] = position - this->outer.begin();
+                    }
+                }
+
+                /**
+                 * @brief Analyses the triangular sweeps, once.
+                 *
+                 */
+                void analyse() {
+                    this->forward = Schedule{this->inner, this->outer, this->diagonal, true};
+                    this->backward = Schedule{this->inner, this->outer, this->diagonal, false};
+                }
+
+            public:
+
+                /**
+                 * @brief Returns z = (LU)^{-1} r through level-scheduled sweeps.
+                 *
+                 * @param residual
+                 * @param result
+                 */
+                void apply(const std::vector<T> &residual, std::vector<T> &result) const {
+                    result.resize(this->diagonal.size());
+
+                    // Forward sweep, L y = r.
+                    this->forward.sweep([this, &residual, &result](const std::size_t &j) {
+                        T sum = residual[j];
+
+                        for(std::size_t k = this->inner[j]; k < this->diagonal[j]; ++k)
+                            sum -= this->values[k] * result[this->outer[k]];
+
+                        result[j] = this->unit ? sum : sum / this->values[this->diagonal[j]];
+                    });
+
+                    // Backward sweep, U z = y.
+                    this->backward.sweep([this, &result](const std::size_t &j) {
+                        T sum = result[j];
+
+                        for(std::size_t k = this->diagonal[j] + 1; k < this->inner[j + 1]; ++k)
+                            sum -= this->values[k] * result[this->outer[k]];
+
+                        result[j] = sum / this->values[this->diagonal[j]];
+                    });
+                }
+
+                /**
+                 * @brief Returns the number of levels of the forward and backward sweeps.
+                 *
+                 * @return std::array<std::size_t, 2>
+                 */
+                std::array<std::size_t, 2> levels() const {
+                    return {this->forward.depth(), this->backward.depth()};
+                }
+        };
+
+        /**
+         * @brief ILU(0) preconditioner for general compressed Matrix<T, Row>.
+         *
+         * @tparam T
+         */
+        template<MatrixType T>
+        class ILU: public Factorization<T> {
+            public:
+
+                /**
+                 * @brief Factorizes the matrix on its own pattern.
+                 *
+                 * @param matrix
+                 */
+                ILU(const Matrix<T, Row> &matrix): Factorization<T>{matrix, true} {
+                    const std::size_t size = matrix.rows();
+
+                    // Positions of row j's entries, size if absent.
+                    std::vector<std::size_t> position;
+                    position.resize(size, size);
+
+                    // IKJ variant.
+                    for(std::size_t j = 0; j < size; ++j) {
+                        for(std::size_t h = this->inner[j]; h < this->inner[j + 1]; ++h)
+                            position[this->outer[h]] = h;
+
+                        for(std::size_t h = this->inner[j]; h < this->diagonal[j]; ++h) {
+                            const std::size_t k = this->outer[h];
+                            const T factor = this->values[h] /= this->values[this->diagonal[k]];
+
+                            for(std::size_t i = this->diagonal[k] + 1; i < this->inner[k + 1]; ++i) {
+                                if(position[this->outer[i]] != size)
+                                    this->values[position[this->outer[i]]] -= factor * this->values[i];
+                            }
+                        }
+
+                        for(std::size_t h = this->inner[j]; h < this->inner[j + 1]; ++h)
+                            position[this->outer[h]] = size;
+                    }
+
+                    this->analyse();
+                }
+        };
+
+        /**
+         * @brief IC(0) preconditioner for Hermitian positive definite compressed Matrix<T, Row>.
+         * The matrix' pattern is assumed to be structurally symmetric, U = L^H is stored in the upper part.
+         * Non-positive pivots fall back to the original diagonal.
+         *
+         * @tparam T
+         */
+        template<MatrixType T>
+        class IC: public Factorization<T> {
+            public:
+
+                /**
+                 * @brief Factorizes the matrix on its own pattern.
+                 *
+                 * @param matrix
+                 */
+                IC(const Matrix<T, Row> &matrix): Factorization<T>{matrix, false} {
+                    const std::size_t size = matrix.rows();
+
+                    // Row-oriented, left-looking L.
+                    for(std::size_t j = 0; j < size; ++j) {
+                        for(std::size_t h = this->inner[j]; h <= this->diagonal[j]; ++h) {
+                            const std::size_t k = this->outer[h];
+                            T sum = this->values[h];
+
+                            // Sparse dot product between rows j and k, up to column k.
+                            std::size_t first = this->inner[j], second = this->inner[k];
+
+                            while((first < h) && (second < this->diagonal[k])) {
+                                if(this->outer[first] < this->outer[second])
+                                    ++first;
+                                else if(this->outer[second] < this->outer[first])
+                                    ++second;
+                                else
+                                    sum -= this->values[first++] * conjugate(this->values[second++]);
+                            }
+
+                            if(k < j) {
+                                this->values[h] = sum / this->values[this->diagonal[k]];
+                            } else {
+                                const double pivot = std::real(sum);
+                                this->values[h] = static_cast<T>(std::sqrt(pivot > 0.0 ? pivot : std::abs(matrix(j, j))));
+                            }
+                        }
+                    }
+
+                    // Mirrors L^H into the upper part.
+                    std::vector<std::size_t> cursor{this->diagonal};
+
+                    for(std::size_t j = 0; j < size; ++j) {
+                        for(std::size_t h = this->inner[j]; h < this->diagonal[j]; ++h) {
+                            const std::size_t k = this->outer[h];
+
+                            while((cursor[k] < this->inner[k + 1]) && (this->outer[cursor[k]] < j))
+                                ++cursor[k];
+
+                            #ifndef NDEBUG // Structural symmetry.
+                            assert((cursor[k] < this->inner[k + 1]) && (this->outer[cursor[k]] == j));
+                            #endif
+
+                            this->values[cursor[k]] = conjugate(this->values[h]);
+                        }
+                    }
+
+                    this->analyse();
+                }
+        };
+
+    }
+
+}
+
+#endif
@@ -0,0 +1,278 @@
+/**
+ * @file Reordering.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-04-26
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef REORDERING_PACS
+#define REORDERING_PACS
+
+// Type.
+#include <Type.hpp>
+
+// Matrix.
+#include <Matrix.hpp>
+
+// Containers.
+#include <vector>
+#include <array>
+
+// Assertions.
+#include <cassert>
+
+// Algorithms.
+#include <algorithm>
+#include <numeric>
+
+namespace pacs {
+
+    namespace algebra {
+
+        /**
+         * @brief Symmetric adjacency structure of a square matrix' pattern, A + A^T without the diagonal.
+         *
+         */
+        struct Graph {
+            std::vector<std::size_t> inner;
+            std::vector<std::size_t> outer;
+
+            /**
+             * @brief Builds the graph of a matrix.
+             *
+             * @tparam T
+             * @tparam O
+             * @param matrix
+             */
+            template<MatrixType T, Order O>
+            Graph(const Matrix<T, O> &matrix) {
+                #ifndef NDEBUG
+                assert(matrix.rows() == matrix.columns());
+                #endif
+
+                const std::size_t size = matrix.rows();
+                std::vector<std::array<std::size_t, 2>> edges;
+
+                if(!(matrix.is_compressed())) {
+                    for(const auto &[key, value]: matrix.get_elements()) {
+                        if(key[0] != key[1]) {
+                            edges.push_back({key[0], key[1]});
+                            edges.push_back({key[1], key[0]});
+                        }
+                    }
+                } else {
+                    const auto &inner = matrix.get_inner();
+                    const auto &outer = matrix.get_outer();
+
+                    edges.reserve(2 * outer.size());
+
+                    for(std::size_t j = 0; j < size; ++j) {
+                        for(std::size_t k = inner[j]; k < inner[j + 1]; ++k) {
+                            if(j != outer[k]) {
+                                edges.push_back({j, outer[k]});
+                                edges.push_back({outer[k], j});
+                            }
+                        }
+                    }
+                }
+
+                std::sort(edges.begin(), edges.end());
+                edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+                this->inner.resize(size + 1, 0);
+                this->outer.resize(edges.size());
+
+                for(std::size_t j = 0; j < edges.size(); ++j) {
+                    ++this->inner[edges[j][0] + 1];
+                    this->outer[j] = edges[j][1];
+                }
+
+                std::inclusive_scan(this->inner.begin(), this->inner.end(), this->inner.begin());
+            }
+
+            /**
+             * @brief Returns the degree of a node.
+             *
+             * @param node
+             * @return std::size_t
+             */
+            inline std::size_t degree(const std::size_t &node) const {
+                return this->inner[node + 1] - this->inner[node];
+            }
+
+            /**
+             * @brief Returns the number of nodes.
+             *
+             * @return std::size_t
+             */
+            inline std::size_t size() const {
+                return this->inner.size() - 1;
+            }
+        };
+
+        /**
+         * @brief Breadth-first level structure rooted at a node, returns its last level and the eccentricity of the root.
+         *
+         * @param graph
+         * @param root
+         * @param marker Stamped visits.
+         * @param stamp
+         * @param last
+         * @return std::size_t
+         */
+        inline std::size_t level_structure(const Graph &graph, const std::size_t &root, std::vector<std::size_t> &marker, const std::size_t &stamp, std::vector<std::size_t> &last) {
+            std::vector<std::size_t> current{root}, next;
+            std::size_t eccentricity = 0;
+            marker[root] = stamp;
+
+            while(true) {
+                next.clear();
+
+                for(const auto &node: current) {
+                    for(std::size_t k = graph.inner[node]; k < graph.inner[node + 1]; ++k) {
+                        if(marker[graph.outer[k]] != stamp) {
+                            marker[graph.outer[k]] = stamp;
+                            next.emplace_back(graph.outer[k]);
+                        }
+                    }
+                }
+
+                if(next.empty())
+                    break;
+
+                current.swap(next);
+                ++eccentricity;
+            }
+
+            last = current;
+            return eccentricity;
+        }
+
+        /**
+         * @brief Reverse Cuthill-McKee ordering of a square matrix, returns the permutation (new to old).
+         * Each connected component starts from a pseudo-peripheral node found by George-Liu's algorithm.
+         *
+         * @tparam T
+         * @tparam O
+         * @param matrix
+         * @return std::vector<std::size_t>
+         */
+        template<MatrixType T, Order O>
+        std::vector<std::size_t> rcm(const Matrix<T, O> &matrix) {
+            const Graph graph{matrix};
+            const std::size_t size = graph.size();
+
+            // Nodes by increasing degree, components' seeds.
+            std::vector<std::size_t> nodes;
+            nodes.resize(size);
+            std::iota(nodes.begin(), nodes.end(), 0);
+            std::stable_sort(nodes.begin(), nodes.end(), [&graph](const std::size_t &first, const std::size_t &second) { return graph.degree(first) < graph.degree(second); });
+
+            std::vector<std::size_t> permutation, marker, last, neighbours;
+            std::vector<bool> visited;
+            permutation.reserve(size);
+            marker.resize(size, 0);
+            visited.resize(size, false);
+
+            std::size_t stamp = 0;
+
+            for(const auto &seed: nodes) {
+                if(visited[seed])
+                    continue;
+
+                // Pseudo-peripheral node.
+                std::size_t root = seed;
+                std::size_t eccentricity = level_structure(graph, root, marker, ++stamp, last);
+
+                while(true) {
+                    const std::size_t candidate = *std::ranges::min_element(last, {}, [&graph](const std::size_t &node) { return graph.degree(node); });
+                    std::vector<std::size_t> candidate_last;
+                    const std::size_t candidate_eccentricity = level_structure(graph, candidate, marker, ++stamp, candidate_last);
+
+                    if(candidate_eccentricity <= eccentricity)
+                        break;
+
+                    root = candidate;
+                    eccentricity = candidate_eccentricity;
+                    last.swap(candidate_last);
+                }
+
+                // Cuthill-McKee, neighbours by increasing degree.
+                std::size_t head = permutation.size();
+                permutation.emplace_back(root);
+                visited[root] = true;
+
+                for(; head < permutation.size(); ++head) {
+                    const std::size_t node = permutation[head];
+                    neighbours.clear();
+
+                    for(std::size_t k = graph.inner[node]; k < graph.inner[node + 1]; ++k) {
+                        if(!(visited[graph.outer[k]])) {
+                            visited[graph.outer[k]] = true;
+                            neighbours.emplace_back(graph.outer[k]);
+                        }
+                    }
+
+                    std::stable_sort(neighbours.begin(), neighbours.end(), [&graph](const std::size_t &first, const std::size_t &second) { return graph.degree(first) < graph.degree(second); });
+                    permutation.insert(permutation.end(), neighbours.begin(), neighbours.end());
+                }
+            }
+
+            std::reverse(permutation.begin(), permutation.end());
+            return permutation;
+        }
+
+        /**
+         * @brief Returns the permuted vector, y[j] = x[permutation[j]].
+         *
+         * @tparam T
+         * @param vector
+         * @param permutation New to old.
+         * @return std::vector<T>
+         */
+        template<MatrixType T>
+        std::vector<T> permute(const std::vector<T> &vector, const std::vector<std::size_t> &permutation) {
+            #ifndef NDEBUG
+            assert(vector.size() == permutation.size());
+            #endif
+
+            std::vector<T> result;
+            result.resize(vector.size());
+
+            for(std::size_t j = 0; j < vector.size(); ++j)
+                result[j] = vector[permutation[j]];
+
+            return result;
+        }
+
+        /**
+         * @brief Returns the unpermuted vector, x[permutation[j]] = y[j].
+         *
+         * @tparam T
+         * @param vector
+         * @param permutation New to old.
+         * @return std::vector<T>
+         */
+        template<MatrixType T>
+        std::vector<T> unpermute(const std::vector<T> &vector, const std::vector<std::size_t> &permutation) {
+            #ifndef NDEBUG
+            assert(vector.size() == permutation.size());
+            #endif
+
+            std::vector<T> result;
+            result.resize(vector.size());
+
+            for(std::size_t j = 0; j < vector.size(); ++j)
+                result[permutation[j]] = vector[j];
+
+            return result;
+        }
+
+    }
+
+}
+
+#endif
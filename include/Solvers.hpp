@@ -0,0 +1,828 @@
+/**
+ * @file Solvers.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-04-22
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SOLVERS_PACS
+#define SOLVERS_PACS
+
+// Type.
+#include <Type.hpp>
+
+// Matrix.
+#include <Matrix.hpp>
+
+// Memory.
+#include <Memory.hpp>
+
+// Containers.
+#include <vector>
+#include <tuple>
+
+// Assertions.
+#include <cassert>
+
+// Concepts.
+#include <concepts>
+#include <type_traits>
+
+// Asynchronous reductions.
+#ifdef PARALLEL_PACS
+#include <Pool.hpp>
+#endif
+
+// Math.
+#include <cmath>
+
+// Limits.
+#include <limits>
+
+namespace pacs {
+
+    namespace algebra {
+
+        // Solvers' interfaces.
+
+        /**
+         * @brief Linear operators, anything exposing an allocation-free product.
+         *
+         * @tparam A
+         * @tparam T
+         */
+        template<typename A, typename T>
+        concept LinearOperator = requires(const A &matrix, const std::vector<T> &vector, std::vector<T> &result) {
+            {matrix.rows()} -> std::convertible_to<std::size_t>;
+            matrix.product(vector, result);
+        };
+
+        /**
+         * @brief Preconditioners, anything exposing z = M^{-1} r.
+         *
+         * @tparam P
+         * @tparam T
+         */
+        template<typename P, typename T>
+        concept Preconditioner = requires(const P &preconditioner, const std::vector<T> &residual, std::vector<T> &result) {
+            preconditioner.apply(residual, result);
+        };
+
+        /**
+         * @brief Identity preconditioner.
+         *
+         * @tparam T
+         */
+        template<MatrixType T>
+        struct Identity {
+            void apply(const std::vector<T> &residual, std::vector<T> &result) const {
+                result = residual;
+            }
+        };
+
+        /**
+         * @brief Gram-Schmidt variants.
+         *
+         */
+        enum Orthogonalization {Modified, Classical};
+
+        /**
+         * @brief Solvers' report.
+         *
+         */
+        struct Report {
+            std::size_t iterations; // Performed iterations.
+            double residual; // Relative residual, ||r|| / ||b||.
+            bool converged;
+        };
+
+        // Vector kernels.
+
+        /**
+         * @brief Complex conjugate, identity on real types.
+         *
+         * @tparam T
+         * @param value
+         * @return T
+         */
+        template<MatrixType T>
+        inline T conjugate(const T &value) {
+            if constexpr (std::is_arithmetic_v<T>)
+                return value;
+            else
+                return std::conj(value);
+        }
+
+        /**
+         * @brief Squared absolute value.
+         *
+         * @tparam T
+         * @param value
+         * @return double
+         */
+        template<MatrixType T>
+        inline double squared(const T &value) {
+            return static_cast<double>(std::abs(value) * std::abs(value));
+        }
+
+        /**
+         * @brief Returns the (conjugate) dot product of two vectors.
+         *
+         * @tparam T
+         * @param first
+         * @param second
+         * @return T
+         */
+        template<MatrixType T>
+        T dot(const std::vector<T> &first, const std::vector<T> &second) {
+            #ifndef NDEBUG
+            assert(first.size() == second.size());
+            #endif
+
+            T sum = static_cast<T>(0);
+
+            for(std::size_t j = 0; j < first.size(); ++j)
+                sum += conjugate(first[j]) * second[j];
+
+            return sum;
+        }
+
+        /**
+         * @brief Blocked multi-vector dot product, result = V^H w over the first count vectors of V.
+         * w is streamed once, tile by tile, while all the vectors of the block are read against it.
+         *
+         * @tparam T
+         * @param block Column-major vectors with leading dimension leading.
+         * @param leading
+         * @param count
+         * @param w
+         * @param result
+         */
+        template<MatrixType T>
+        void dots(const Block<T> &block, const std::size_t &leading, const std::size_t &count, const std::vector<T> &w, std::vector<T> &result) {
+            constexpr std::size_t tile = 512;
+
+            result.assign(count, static_cast<T>(0));
+
+            for(std::size_t start = 0; start < w.size(); start += tile) {
+                const std::size_t stop = std::min(start + tile, w.size());
+
+                for(std::size_t k = 0; k < count; ++k) {
+                    const T *vector = block.data() + k * leading;
+                    T sum = static_cast<T>(0);
+
+                    for(std::size_t j = start; j < stop; ++j)
+                        sum += conjugate(vector[j]) * w[j];
+
+                    result[k] += sum;
+                }
+            }
+        }
+
+        /**
+         * @brief Blocked multi-vector update, w += sign * V c over the first count vectors of V.
+         *
+         * @tparam T
+         * @param block Column-major vectors with leading dimension leading.
+         * @param leading
+         * @param count
+         * @param coefficients
+         * @param w
+         * @param sign
+         */
+        template<MatrixType T>
+        void combine(const Block<T> &block, const std::size_t &leading, const std::size_t &count, const std::vector<T> &coefficients, std::vector<T> &w, const T &sign) {
+            constexpr std::size_t tile = 512;
+
+            for(std::size_t start = 0; start < w.size(); start += tile) {
+                const std::size_t stop = std::min(start + tile, w.size());
+
+                for(std::size_t k = 0; k < count; ++k) {
+                    const T *vector = block.data() + k * leading;
+                    const T coefficient = sign * coefficients[k];
+
+                    for(std::size_t j = start; j < stop; ++j)
+                        w[j] += coefficient * vector[j];
+                }
+            }
+        }
+
+        // Conjugate Gradient.
+
+        /**
+         * @brief Preconditioned Conjugate Gradient for Hermitian positive definite systems.
+         * x is used as the initial guess and overwritten with the solution.
+         * Vector updates are fused so that each iteration streams memory once past the product and the preconditioner.
+         *
+         * @tparam T
+         * @tparam A
+         * @tparam P
+         * @param matrix
+         * @param b
+         * @param x
+         * @param preconditioner
+         * @param tolerance Relative residual tolerance.
+         * @param maximum Maximum number of iterations.
+         * @return Report
+         */
+        template<MatrixType T, LinearOperator<T> A, Preconditioner<T> P = Identity<T>>
+        Report cg(const A &matrix, const std::vector<T> &b, std::vector<T> &x, const P &preconditioner = P{}, const double &tolerance = 1E-8, const std::size_t &maximum = 1E4) {
+            constexpr bool identity = std::is_same_v<P, Identity<T>>;
+            const std::size_t size = matrix.rows();
+
+            #ifndef NDEBUG
+            assert(b.size() == size);
+            #endif
+
+            if(x.size() != size)
+                x.resize(size, static_cast<T>(0));
+
+            std::vector<T> r, z, p, q;
+            r.resize(size);
+
+            // Initial residual.
+            matrix.product(x, q);
+            double norm_b = 0.0, norm_r = 0.0;
+
+            for(std::size_t j = 0; j < size; ++j) {
+                r[j] = b[j] - q[j];
+                norm_b += squared(b[j]);
+                norm_r += squared(r[j]);
+            }
+
+            norm_b = norm_b > 0.0 ? std::sqrt(norm_b) : 1.0;
+
+            if(std::sqrt(norm_r) <= tolerance * norm_b)
+                return {0, std::sqrt(norm_r) / norm_b, true};
+
+            // Preconditioned residual, aliases r when unpreconditioned.
+            if constexpr (!identity)
+                preconditioner.apply(r, z);
+
+            const std::vector<T> &residual = identity ? r : z;
+
+            p = residual;
+            T rz = identity ? static_cast<T>(norm_r) : dot(r, z);
+
+            for(std::size_t iteration = 1; iteration <= maximum; ++iteration) {
+                matrix.product(p, q);
+                T alpha = rz / dot(p, q);
+
+                // Fused x, r updates and residual norm.
+                norm_r = 0.0;
+
+                for(std::size_t j = 0; j < size; ++j) {
+                    x[j] += alpha * p[j];
+                    r[j] -= alpha * q[j];
+                    norm_r += squared(r[j]);
+                }
+
+                if(std::sqrt(norm_r) <= tolerance * norm_b)
+                    return {iteration, std::sqrt(norm_r) / norm_b, true};
+
+                T next = static_cast<T>(norm_r);
+
+                if constexpr (!identity) {
+                    preconditioner.apply(r, z);
+                    next = dot(r, z);
+                }
+
+                T beta = next / rz;
+                rz = next;
+
+                for(std::size_t j = 0; j < size; ++j)
+                    p[j] = residual[j] + beta * p[j];
+            }
+
+            return {maximum, std::sqrt(norm_r) / norm_b, false};
+        }
+
+        /**
+         * @brief Pipelined (Ghysels-Vanroose) preconditioned Conjugate Gradient.
+         * The three reductions of an iteration are independent of its product and preconditioner application,
+         * they run concurrently when parallel computing is enabled. All vector recurrences are fused into a single pass.
+         *
+         * @tparam T
+         * @tparam A
+         * @tparam P
+         * @param matrix
+         * @param b
+         * @param x
+         * @param preconditioner
+         * @param tolerance Relative residual tolerance.
+         * @param maximum Maximum number of iterations.
+         * @return Report
+         */
+        template<MatrixType T, LinearOperator<T> A, Preconditioner<T> P = Identity<T>>
+        Report pipelined_cg(const A &matrix, const std::vector<T> &b, std::vector<T> &x, const P &preconditioner = P{}, const double &tolerance = 1E-8, const std::size_t &maximum = 1E4) {
+            constexpr bool identity = std::is_same_v<P, Identity<T>>;
+            const std::size_t size = matrix.rows();
+
+            #ifndef NDEBUG
+            assert(b.size() == size);
+            #endif
+
+            if(x.size() != size)
+                x.resize(size, static_cast<T>(0));
+
+            std::vector<T> r, u, w, m, n, z, q, s, p;
+            r.resize(size);
+            z.resize(size, static_cast<T>(0));
+            q.resize(size, static_cast<T>(0));
+            s.resize(size, static_cast<T>(0));
+            p.resize(size, static_cast<T>(0));
+
+            // Initial residual.
+            matrix.product(x, w);
+            double norm_b = 0.0;
+
+            for(std::size_t j = 0; j < size; ++j) {
+                r[j] = b[j] - w[j];
+                norm_b += squared(b[j]);
+            }
+
+            norm_b = norm_b > 0.0 ? std::sqrt(norm_b) : 1.0;
+
+            preconditioner.apply(r, u);
+            matrix.product(u, w);
+
+            // m = M^{-1} w, aliases w when unpreconditioned.
+            const std::vector<T> &preconditioned = identity ? w : m;
+
+            // Reductions: (r, u), (w, u), (r, r).
+            auto reduce = [&r, &u, &w, &size]() {
+                T gamma = static_cast<T>(0), delta = static_cast<T>(0);
+                double norm_r = 0.0;
+
+                for(std::size_t j = 0; j < size; ++j) {
+                    gamma += conjugate(r[j]) * u[j];
+                    delta += conjugate(w[j]) * u[j];
+                    norm_r += squared(r[j]);
+                }
+
+                return std::tuple<T, T, double>{gamma, delta, norm_r};
+            };
+
+            T gamma_old = static_cast<T>(1), alpha_old = static_cast<T>(1);
+            double norm_r = 0.0;
+
+            for(std::size_t iteration = 0; iteration < maximum; ++iteration) {
+                T gamma, delta;
+
+                #ifdef PARALLEL_PACS // Overlapped reductions.
+                auto reductions = Pool::instance().async(reduce);
+
+                if constexpr (!identity)
+                    preconditioner.apply(w, m);
+
+                matrix.product(preconditioned, n);
+                std::tie(gamma, delta, norm_r) = Pool::instance().await(reductions);
+                #else
+                std::tie(gamma, delta, norm_r) = reduce();
+
+                if constexpr (!identity)
+                    preconditioner.apply(w, m);
+
+                matrix.product(preconditioned, n);
+                #endif
+
+                if(std::sqrt(norm_r) <= tolerance * norm_b)
+                    return {iteration, std::sqrt(norm_r) / norm_b, true};
+
+                T beta = static_cast<T>(0), alpha = gamma / delta;
+
+                if(iteration > 0) {
+                    beta = gamma / gamma_old;
+                    alpha = gamma / (delta - beta * gamma / alpha_old);
+                }
+
+                // Fused recurrences, w is updated last as it may alias m.
+                for(std::size_t j = 0; j < size; ++j) {
+                    z[j] = n[j] + beta * z[j];
+                    q[j] = preconditioned[j] + beta * q[j];
+                    s[j] = w[j] + beta * s[j];
+                    p[j] = u[j] + beta * p[j];
+
+                    x[j] += alpha * p[j];
+                    r[j] -= alpha * s[j];
+                    u[j] -= alpha * q[j];
+                    w[j] -= alpha * z[j];
+                }
+
+                gamma_old = gamma;
+                alpha_old = alpha;
+            }
+
+            return {maximum, std::sqrt(norm_r) / norm_b, false};
+        }
+
+        // Nonsymmetric solvers.
+
+        /**
+         * @brief Restarted, right-preconditioned GMRES(m).
+         * The Krylov basis lives in a single cache-aligned block. Classical Gram-Schmidt uses blocked multi-vector kernels,
+         * both variants reorthogonalise once whenever the orthogonalisation cancels more than 1 - 1 / sqrt(2) of the vector's norm.
+         *
+         * @tparam T
+         * @tparam A
+         * @tparam P
+         * @param matrix
+         * @param b
+         * @param x
+         * @param preconditioner
+         * @param tolerance Relative residual tolerance.
+         * @param maximum Maximum number of iterations.
+         * @param restart Krylov subspace dimension, m.
+         * @param orthogonalization
+         * @return Report
+         */
+        template<MatrixType T, LinearOperator<T> A, Preconditioner<T> P = Identity<T>>
+        Report gmres(const A &matrix, const std::vector<T> &b, std::vector<T> &x, const P &preconditioner = P{}, const double &tolerance = 1E-8, const std::size_t &maximum = 1E4, const std::size_t &restart = 30, const Orthogonalization &orthogonalization = Classical) {
+            constexpr bool identity = std::is_same_v<P, Identity<T>>;
+            const std::size_t size = matrix.rows();
+            const std::size_t leading = padded<T>(size);
+
+            #ifndef NDEBUG
+            assert(b.size() == size);
+            assert(restart > 0);
+            #endif
+
+            if(x.size() != size)
+                x.resize(size, static_cast<T>(0));
+
+            // Krylov basis, (m + 1) vectors.
+            Block<T> basis;
+            basis.resize(leading * (restart + 1), static_cast<T>(0));
+
+            // Hessenberg matrix (column-major), rotations and right-hand side.
+            std::vector<T> hessenberg, cosines, sines, g, h, correction;
+            hessenberg.resize((restart + 1) * restart, static_cast<T>(0));
+            cosines.resize(restart);
+            sines.resize(restart);
+            g.resize(restart + 1);
+
+            std::vector<T> w, z;
+
+            double norm_b = 0.0;
+
+            for(const auto &value: b)
+                norm_b += squared(value);
+
+            norm_b = norm_b > 0.0 ? std::sqrt(norm_b) : 1.0;
+
+            std::size_t iteration = 0;
+            double residual = 0.0;
+
+            while(true) {
+
+                // Restart residual.
+                matrix.product(x, w);
+                double beta = 0.0;
+
+                for(std::size_t j = 0; j < size; ++j) {
+                    w[j] = b[j] - w[j];
+                    beta += squared(w[j]);
+                }
+
+                beta = std::sqrt(beta);
+                residual = beta / norm_b;
+
+                if((residual <= tolerance) || (iteration >= maximum))
+                    return {iteration, residual, residual <= tolerance};
+
+                for(std::size_t j = 0; j < size; ++j)
+                    basis[j] = w[j] / static_cast<T>(beta);
+
+                std::ranges::fill(g, static_cast<T>(0));
+                g[0] = static_cast<T>(beta);
+
+                std::size_t columns = 0;
+
+                // Arnoldi process.
+                for(; (columns < restart) && (iteration < maximum); ++columns) {
+                    const std::size_t j = columns;
+                    ++iteration;
+
+                    // w = A M^{-1} v_j.
+                    if constexpr (identity) {
+                        z.assign(basis.begin() + j * leading, basis.begin() + j * leading + size);
+                    } else {
+                        w.assign(basis.begin() + j * leading, basis.begin() + j * leading + size);
+                        preconditioner.apply(w, z);
+                    }
+
+                    matrix.product(z, w);
+
+                    double norm_w = 0.0;
+
+                    for(const auto &value: w)
+                        norm_w += squared(value);
+
+                    norm_w = std::sqrt(norm_w);
+
+                    T *column = hessenberg.data() + j * (restart + 1);
+                    std::fill(column, column + restart + 1, static_cast<T>(0));
+
+                    // Orthogonalisation and, if needed, reorthogonalisation.
+                    for(std::size_t pass = 0; pass < 2; ++pass) {
+                        if(orthogonalization == Classical) {
+                            dots(basis, leading, j + 1, w, h);
+                            combine(basis, leading, j + 1, h, w, static_cast<T>(-1));
+
+                            for(std::size_t k = 0; k <= j; ++k)
+                                column[k] += h[k];
+                        } else {
+                            for(std::size_t k = 0; k <= j; ++k) {
+                                const T *vector = basis.data() + k * leading;
+                                T coefficient = static_cast<T>(0);
+
+                                for(std::size_t i = 0; i < size; ++i)
+                                    coefficient += conjugate(vector[i]) * w[i];
+
+                                for(std::size_t i = 0; i < size; ++i)
+                                    w[i] -= coefficient * vector[i];
+
+                                column[k] += coefficient;
+                            }
+                        }
+
+                        double norm = 0.0;
+
+                        for(const auto &value: w)
+                            norm += squared(value);
+
+                        norm = std::sqrt(norm);
+
+                        // Kahan's "twice is enough" criterion.
+                        const bool orthogonal = norm > norm_w / std::sqrt(2.0);
+                        norm_w = norm;
+
+                        if(orthogonal)
+                            break;
+                    }
+
+                    column[j + 1] = static_cast<T>(norm_w);
+
+                    if(norm_w > 0.0) {
+                        T *next = basis.data() + (j + 1) * leading;
+
+                        for(std::size_t i = 0; i < size; ++i)
+                            next[i] = w[i] / static_cast<T>(norm_w);
+                    }
+
+                    // Previous rotations.
+                    for(std::size_t k = 0; k < j; ++k) {
+                        const T first = column[k], second = column[k + 1];
+                        column[k] = cosines[k] * first + sines[k] * second;
+                        column[k + 1] = -conjugate(sines[k]) * first + cosines[k] * second;
+                    }
+
+                    // New rotation.
+                    const double absolute = std::abs(column[j]), norm = std::sqrt(squared(column[j]) + norm_w * norm_w);
+
+                    if(norm_w == 0.0) {
+                        cosines[j] = static_cast<T>(1);
+                        sines[j] = static_cast<T>(0);
+                    } else if(absolute == 0.0) {
+                        cosines[j] = static_cast<T>(0);
+                        sines[j] = static_cast<T>(1);
+                    } else {
+                        cosines[j] = static_cast<T>(absolute / norm);
+                        sines[j] = column[j] / static_cast<T>(absolute) * static_cast<T>(norm_w / norm);
+                    }
+
+                    column[j] = cosines[j] * column[j] + sines[j] * static_cast<T>(norm_w);
+                    column[j + 1] = static_cast<T>(0);
+
+                    g[j + 1] = -conjugate(sines[j]) * g[j];
+                    g[j] = cosines[j] * g[j];
+
+                    residual = std::abs(g[j + 1]) / norm_b;
+
+                    if((residual <= tolerance) || (norm_w == 0.0)) {
+                        ++columns;
+                        break;
+                    }
+                }
+
+                // Upper triangular solve, H y = g.
+                for(std::size_t k = columns; k-- > 0;) {
+                    for(std::size_t i = k + 1; i < columns; ++i)
+                        g[k] -= hessenberg[i * (restart + 1) + k] * g[i];
+
+                    g[k] /= hessenberg[k * (restart + 1) + k];
+                }
+
+                // x += M^{-1} V y.
+                correction.assign(size, static_cast<T>(0));
+                combine(basis, leading, columns, g, correction, static_cast<T>(1));
+
+                if constexpr (!identity) {
+                    preconditioner.apply(correction, z);
+                    correction.swap(z);
+                }
+
+                for(std::size_t j = 0; j < size; ++j)
+                    x[j] += correction[j];
+            }
+        }
+
+        /**
+         * @brief Right-preconditioned BiCGStab.
+         * Vector updates and their reductions are fused into single passes.
+         *
+         * @tparam T
+         * @tparam A
+         * @tparam P
+         * @param matrix
+         * @param b
+         * @param x
+         * @param preconditioner
+         * @param tolerance Relative residual tolerance.
+         * @param maximum Maximum number of iterations.
+         * @return Report
+         */
+        template<MatrixType T, LinearOperator<T> A, Preconditioner<T> P = Identity<T>>
+        Report bicgstab(const A &matrix, const std::vector<T> &b, std::vector<T> &x, const P &preconditioner = P{}, const double &tolerance = 1E-8, const std::size_t &maximum = 1E4) {
+            constexpr bool identity = std::is_same_v<P, Identity<T>>;
+            const std::size_t size = matrix.rows();
+
+            #ifndef NDEBUG
+            assert(b.size() == size);
+            #endif
+
+            if(x.size() != size)
+                x.resize(size, static_cast<T>(0));
+
+            std::vector<T> r, shadow, p, v, s, t, p_hat, s_hat;
+            p.resize(size, static_cast<T>(0));
+            v.resize(size, static_cast<T>(0));
+            s.resize(size);
+
+            // Initial residual.
+            matrix.product(x, r);
+            double norm_b = 0.0, norm_r = 0.0;
+
+            for(std::size_t j = 0; j < size; ++j) {
+                r[j] = b[j] - r[j];
+                norm_b += squared(b[j]);
+                norm_r += squared(r[j]);
+            }
+
+            norm_b = norm_b > 0.0 ? std::sqrt(norm_b) : 1.0;
+
+            if(std::sqrt(norm_r) <= tolerance * norm_b)
+                return {0, std::sqrt(norm_r) / norm_b, true};
+
+            shadow = r;
+
+            // Preconditioned directions, alias p and s when unpreconditioned.
+            const std::vector<T> &direction = identity ? p : p_hat;
+            const std::vector<T> &stabilizer = identity ? s : s_hat;
+
+            T rho = static_cast<T>(1), alpha = static_cast<T>(1), omega = static_cast<T>(1);
+
+            for(std::size_t iteration = 1; iteration <= maximum; ++iteration) {
+                const T rho_next = dot(shadow, r);
+
+                if(std::abs(rho_next) == 0.0) // Breakdown.
+                    return {iteration, std::sqrt(norm_r) / norm_b, false};
+
+                const T beta = (rho_next / rho) * (alpha / omega);
+                rho = rho_next;
+
+                for(std::size_t j = 0; j < size; ++j)
+                    p[j] = r[j] + beta * (p[j] - omega * v[j]);
+
+                if constexpr (!identity)
+                    preconditioner.apply(p, p_hat);
+
+                matrix.product(direction, v);
+                alpha = rho / dot(shadow, v);
+
+                // Fused s update and norm.
+                double norm_s = 0.0;
+
+                for(std::size_t j = 0; j < size; ++j) {
+                    s[j] = r[j] - alpha * v[j];
+                    norm_s += squared(s[j]);
+                }
+
+                if(std::sqrt(norm_s) <= tolerance * norm_b) {
+                    for(std::size_t j = 0; j < size; ++j)
+                        x[j] += alpha * direction[j];
+
+                    return {iteration, std::sqrt(norm_s) / norm_b, true};
+                }
+
+                if constexpr (!identity)
+                    preconditioner.apply(s, s_hat);
+
+                matrix.product(stabilizer, t);
+
+                // Fused (t, s) and (t, t).
+                T ts = static_cast<T>(0);
+                double tt = 0.0;
+
+                for(std::size_t j = 0; j < size; ++j) {
+                    ts += conjugate(t[j]) * s[j];
+                    tt += squared(t[j]);
+                }
+
+                omega = ts / static_cast<T>(tt);
+
+                // Fused x, r updates and residual norm.
+                norm_r = 0.0;
+
+                for(std::size_t j = 0; j < size; ++j) {
+                    x[j] += alpha * direction[j] + omega * stabilizer[j];
+                    r[j] = s[j] - omega * t[j];
+                    norm_r += squared(r[j]);
+                }
+
+                if(std::sqrt(norm_r) <= tolerance * norm_b)
+                    return {iteration, std::sqrt(norm_r) / norm_b, true};
+
+                if(std::abs(omega) == 0.0) // Breakdown.
+                    return {iteration, std::sqrt(norm_r) / norm_b, false};
+            }
+
+            return {maximum, std::sqrt(norm_r) / norm_b, false};
+        }
+
+        /**
+         * @brief Iterative refinement: the residual is computed with matrix, the correction by an inner solve, typically on a narrower operator, see Precision.hpp.
+         * Recovers matrix' accuracy while most of the work runs at the inner operator's bandwidth cost.
+         *
+         * @tparam T
+         * @tparam A
+         * @tparam S
+         * @param matrix Full precision operator.
+         * @param b
+         * @param x Initial guess, overwritten.
+         * @param solve Inner solver, solve(r, d) approximately solves A d = r from d = 0.
+         * @param tolerance Relative residual tolerance.
+         * @param maximum Maximum number of refinements.
+         * @return Report
+         */
+        template<MatrixType T, LinearOperator<T> A, typename S>
+        requires std::invocable<const S &, const std::vector<T> &, std::vector<T> &>
+        Report refine(const A &matrix, const std::vector<T> &b, std::vector<T> &x, const S &solve, const double &tolerance = 1E-12, const std::size_t &maximum = 50) {
+            const std::size_t size = matrix.rows();
+
+            #ifndef NDEBUG
+            assert(b.size() == size);
+            #endif
+
+            if(x.size() != size)
+                x.resize(size, static_cast<T>(0));
+
+            std::vector<T> r, d;
+            double norm_b = 0.0, norm_r = 0.0, previous = std::numeric_limits<double>::max();
+
+            for(std::size_t j = 0; j < size; ++j)
+                norm_b += squared(b[j]);
+
+            norm_b = norm_b > 0.0 ? std::sqrt(norm_b) : 1.0;
+
+            for(std::size_t iteration = 0; iteration <= maximum; ++iteration) {
+
+                // Full precision residual.
+                matrix.product(x, r);
+                norm_r = 0.0;
+
+                for(std::size_t j = 0; j < size; ++j) {
+                    r[j] = b[j] - r[j];
+                    norm_r += squared(r[j]);
+                }
+
+                norm_r = std::sqrt(norm_r);
+
+                if(norm_r <= tolerance * norm_b)
+                    return {iteration, norm_r / norm_b, true};
+
+                // Stagnation, the inner solve's accuracy is exhausted.
+                if((iteration == maximum) || (norm_r >= previous))
+                    return {iteration, norm_r / norm_b, false};
+
+                previous = norm_r;
+
+                // Correction.
+                d.assign(size, static_cast<T>(0));
+                solve(r, d);
+
+                for(std::size_t j = 0; j < size; ++j)
+                    x[j] += d[j];
+            }
+
+            return {maximum, norm_r / norm_b, false};
+        }
+
+    }
+
+}
+
+#endif
@@ -0,0 +1,381 @@
+/**
+ * @file Sparse.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-05-08
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SPARSE_PACS
+#define SPARSE_PACS
+
+// Type.
+#include <Type.hpp>
+
+// Matrix.
+#include <Matrix.hpp>
+
+// Thread pool.
+#ifdef PARALLEL_PACS
+#include <Pool.hpp>
+#endif
+
+// Containers.
+#include <vector>
+#include <utility>
+
+// Assertions.
+#include <cassert>
+
+// Algorithms.
+#include <algorithm>
+#include <numeric>
+
+// Output.
+#include <iostream>
+
+// Dense accumulation threshold, rows per product.
+#ifndef SPREAD_PACS
+#define SPREAD_PACS 8
+#endif
+
+namespace pacs {
+
+    namespace algebra {
+
+        /**
+         * @brief Sparse vector: increasing indices and their values.
+         *
+         * @tparam T
+         */
+        template<MatrixType T>
+        class SparseVector {
+            private:
+
+                std::size_t length;
+
+                std::vector<std::size_t> indices;
+                std::vector<T> values;
+
+            public:
+
+                // CONSTRUCTORS.
+
+                /**
+                 * @brief Builds an empty, zero, sparse vector.
+                 *
+                 * @param length
+                 */
+                SparseVector(const std::size_t &length): length{length} {}
+
+                /**
+                 * @brief Builds a sparse vector from increasing indices and their values.
+                 *
+                 * @param length
+                 * @param indices
+                 * @param values
+                 */
+                SparseVector(const std::size_t &length, const std::vector<std::size_t> &indices, const std::vector<T> &values): length{length}, indices{indices}, values{values} {
+                    #ifndef NDEBUG
+                    assert(indices.size() == values.size());
+                    assert(std::ranges::adjacent_find(indices, std::greater_equal<std::size_t>{}) == indices.end());
+                    assert(indices.empty() || (indices.back() < length));
+                    #endif
+                }
+
+                /**
+                 * @brief Builds a sparse vector from a dense one, keeping its elements above TOLERANCE_PACS.
+                 *
+                 * @param vector
+                 */
+                SparseVector(const std::vector<T> &vector): length{vector.size()} {
+                    for(std::size_t j = 0; j < vector.size(); ++j) {
+                        if(std::abs(vector[j]) > TOLERANCE_PACS) {
+                            this->indices.emplace_back(j);
+                            this->values.emplace_back(vector[j]);
+                        }
+                    }
+                }
+
+                // ELEMENTS.
+
+                /**
+                 * @brief Appends an element, past the last one.
+                 *
+                 * @param index
+                 * @param value
+                 */
+                void push(const std::size_t &index, const T &value) {
+                    #ifndef NDEBUG
+                    assert(index < this->length);
+                    assert(this->indices.empty() || (this->indices.back() < index));
+                    #endif
+
+                    this->indices.emplace_back(index);
+                    this->values.emplace_back(value);
+                }
+
+                /**
+                 * @brief Removes every element.
+                 *
+                 */
+                void clear() {
+                    this->indices.clear();
+                    this->values.clear();
+                }
+
+                /**
+                 * @brief Returns the dense vector.
+                 *
+                 * @return std::vector<T>
+                 */
+                std::vector<T> dense() const {
+                    std::vector<T> vector;
+                    vector.resize(this->length, static_cast<T>(0));
+
+                    for(std::size_t j = 0; j < this->indices.size(); ++j)
+                        vector[this->indices[j]] = this->values[j];
+
+                    return vector;
+                }
+
+                /**
+                 * @brief Returns the indices.
+                 *
+                 * @return const std::vector<std::size_t>&
+                 */
+                inline const std::vector<std::size_t> &get_indices() const {
+                    return this->indices;
+                }
+
+                /**
+                 * @brief Returns the values.
+                 *
+                 * @return const std::vector<T>&
+                 */
+                inline const std::vector<T> &get_values() const {
+                    return this->values;
+                }
+
+                // INFO.
+
+                /**
+                 * @brief Returns the vector's length.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t size() const {
+                    return this->length;
+                }
+
+                /**
+                 * @brief Returns the number of stored elements.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t nonzeros() const {
+                    return this->indices.size();
+                }
+
+                // OUTPUT.
+
+                /**
+                 * @brief Sparse vector output.
+                 *
+                 * @param ost
+                 * @param vector
+                 * @return std::ostream&
+                 */
+                friend std::ostream &operator <<(std::ostream &ost, const SparseVector &vector) {
+                    for(std::size_t j = 0; j < vector.indices.size(); ++j) {
+                        ost << "(" << vector.indices[j] << "): " << vector.values[j];
+
+                        if(j < vector.indices.size() - 1)
+                            ost << std::endl;
+                    }
+
+                    return ost;
+                }
+
+                // FRIENDS.
+
+                template<MatrixType U>
+                friend void spmspv(const Matrix<U, Column> &, const SparseVector<U> &, SparseVector<U> &);
+        };
+
+        /**
+         * @brief Writes the product of a compressed Column Matrix x SparseVector into result, reusing its storage.
+         * Only the vector's columns are read, and their products are scattered into buckets of contiguous rows, then each bucket is merged on its own, either through a dense accumulator on its rows or by sorting, whichever is cheaper; the cost is proportional to the products rather than to the Matrix' size.
+         * Elements are structural: cancellations are kept. Symmetric storage is expanded first, in full.
+         *
+         * @tparam T
+         * @param matrix
+         * @param vector
+         * @param result
+         */
+        template<MatrixType T>
+        void spmspv(const Matrix<T, Column> &matrix, const SparseVector<T> &vector, SparseVector<T> &result) {
+            #ifndef NDEBUG
+            assert(matrix.is_compressed());
+            assert(vector.size() == matrix.columns());
+            assert(&vector != &result);
+            #endif
+
+            if(matrix.is_symmetric()) {
+                Matrix<T, Column> expanded = matrix;
+                expanded.expand();
+
+                spmspv(expanded, vector, result);
+                return;
+            }
+
+            const auto &inner = matrix.get_inner();
+            const auto &outer = matrix.get_outer();
+            const auto &values = matrix.get_values();
+
+            const std::size_t rows = matrix.rows(), nonzeros = vector.nonzeros();
+
+            result.length = rows;
+            result.clear();
+
+            if((nonzeros == 0) || (rows == 0))
+                return;
+
+            #ifdef PARALLEL_PACS
+            const std::size_t buckets = std::min(rows, Pool::instance().threads() * CHUNKS_PACS);
+            #else
+            const std::size_t buckets = 1;
+            #endif
+
+            const std::size_t chunks = std::min(nonzeros, buckets);
+
+            // Products per chunk of the vector and bucket of rows.
+            std::vector<std::size_t> counts;
+            counts.resize(chunks * buckets, 0);
+
+            each(chunks, [&vector, &inner, &outer, &counts, &rows, &buckets, &chunks, &nonzeros](const std::size_t &c) {
+                for(std::size_t h = c * nonzeros / chunks; h < (c + 1) * nonzeros / chunks; ++h) {
+                    const std::size_t j = vector.indices[h];
+
+                    for(std::size_t k = inner[j]; k < inner[j + 1]; ++k)
+                        ++counts[c * buckets + outer[k] * buckets / rows];
+                }
+            });
+
+            // Cursors, buckets contiguous.
+            std::vector<std::size_t> starts;
+            starts.resize(buckets + 1, 0);
+
+            std::vector<std::size_t> cursors;
+            cursors.resize(chunks * buckets);
+
+            for(std::size_t b = 0, position = 0; b < buckets; ++b) {
+                starts[b] = position;
+
+                for(std::size_t c = 0; c < chunks; ++c) {
+                    cursors[c * buckets + b] = position;
+                    position += counts[c * buckets + b];
+                }
+
+                starts[b + 1] = position;
+            }
+
+            // Scattered products.
+            std::vector<std::pair<std::size_t, T>> products;
+            products.resize(starts[buckets]);
+
+            each(chunks, [&vector, &inner, &outer, &values, &cursors, &products, &rows, &buckets, &chunks, &nonzeros](const std::size_t &c) {
+                for(std::size_t h = c * nonzeros / chunks; h < (c + 1) * nonzeros / chunks; ++h) {
+                    const std::size_t j = vector.indices[h];
+                    const T scale = vector.values[h];
+
+                    for(std::size_t k = inner[j]; k < inner[j + 1]; ++k)
+                        products[cursors[c * buckets + outer[k] * buckets / rows]++] = {outer[k], values[k] * scale};
+                }
+            });
+
+            // Merges, bucket by bucket.
+            std::vector<std::vector<std::pair<std::size_t, T>>> merged;
+            merged.resize(buckets);
+
+            each(buckets, [&starts, &products, &merged, &rows, &buckets](const std::size_t &b) {
+                const std::size_t lower = (b * rows + buckets - 1) / buckets, upper = ((b + 1) * rows + buckets - 1) / buckets;
+                const std::size_t count = starts[b + 1] - starts[b];
+
+                if(count == 0)
+                    return;
+
+                auto &bucket = merged[b];
+
+                // Dense accumulator on the bucket's rows.
+                if(upper - lower <= SPREAD_PACS * count) {
+                    std::vector<T> accumulator;
+                    std::vector<bool> touched;
+                    accumulator.resize(upper - lower, static_cast<T>(0));
+                    touched.resize(upper - lower, false);
+
+                    for(std::size_t k = starts[b]; k < starts[b + 1]; ++k) {
+                        accumulator[products[k].first - lower] += products[k].second;
+                        touched[products[k].first - lower] = true;
+                    }
+
+                    for(std::size_t j = 0; j < upper - lower; ++j) {
+                        if(touched[j])
+                            bucket.emplace_back(lower + j, accumulator[j]);
+                    }
+
+                    return;
+                }
+
+                // Sorted products.
+                std::sort(products.begin() + starts[b], products.begin() + starts[b + 1], [](const auto &first, const auto &second) { return first.first < second.first; });
+
+                for(std::size_t k = starts[b]; k < starts[b + 1]; ++k) {
+                    if(bucket.empty() || (bucket.back().first != products[k].first))
+                        bucket.emplace_back(products[k]);
+                    else
+                        bucket.back().second += products[k].second;
+                }
+            });
+
+            // Buckets' rows are increasing.
+            std::vector<std::size_t> offsets;
+            offsets.resize(buckets + 1, 0);
+
+            for(std::size_t b = 0; b < buckets; ++b)
+                offsets[b + 1] = offsets[b] + merged[b].size();
+
+            result.indices.resize(offsets[buckets]);
+            result.values.resize(offsets[buckets]);
+
+            each(buckets, [&merged, &offsets, &result](const std::size_t &b) {
+                for(std::size_t k = 0; k < merged[b].size(); ++k) {
+                    result.indices[offsets[b] + k] = merged[b][k].first;
+                    result.values[offsets[b] + k] = merged[b][k].second;
+                }
+            });
+        }
+
+        /**
+         * @brief Returns the product of a compressed Column Matrix x SparseVector.
+         *
+         * @tparam T
+         * @param matrix
+         * @param vector
+         * @return SparseVector<T>
+         */
+        template<MatrixType T>
+        SparseVector<T> operator *(const Matrix<T, Column> &matrix, const SparseVector<T> &vector) {
+            SparseVector<T> result{matrix.rows()};
+            spmspv(matrix, vector, result);
+
+            return result;
+        }
+
+    }
+
+}
+
+#endif
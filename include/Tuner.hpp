@@ -0,0 +1,757 @@
+/**
+ * @file Tuner.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief
+ * @date 2024-05-02
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef TUNER_PACS
+#define TUNER_PACS
+
+// Type.
+#include <Type.hpp>
+
+// Matrix.
+#include <Matrix.hpp>
+
+// First-touch storage.
+#include <Memory.hpp>
+
+// Thread pool.
+#ifdef PARALLEL_PACS
+#include <Pool.hpp>
+#endif
+
+// Containers.
+#include <vector>
+#include <array>
+#include <map>
+#include <string>
+#include <optional>
+
+// Output.
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+
+// Limits.
+#include <limits>
+
+// Concurrency.
+#include <mutex>
+
+// Chrono.
+#include <chrono>
+
+// Assertions.
+#include <cassert>
+
+// Algorithms.
+#include <algorithm>
+#include <numeric>
+
+// Integers.
+#include <cstdint>
+#include <cstdlib>
+
+// SELL-C-sigma's slice height and sorting window, in slices.
+#ifndef SLICE_PACS
+#define SLICE_PACS 8
+#endif
+
+#ifndef WINDOW_PACS
+#define WINDOW_PACS 32
+#endif
+
+namespace pacs {
+
+    namespace algebra {
+
+        /**
+         * @brief Matrix x Vector kernels.
+         * Native runs the Matrix' own product, Serial and RowSplit sweep CSR rows, MergePath splits CSR rows and elements evenly, Sell runs SELL-C-sigma, Blocked runs BCSR and Symmetric the symmetric storage's single pass.
+         *
+         */
+        enum class Kernel {Native, Serial, RowSplit, MergePath, Sell, Blocked, Symmetric};
+
+        /**
+         * @brief Returns a kernel's name.
+         *
+         * @param kernel
+         * @return std::string
+         */
+        inline std::string name(const Kernel &kernel) {
+            constexpr std::array<const char *, 7> names = {"native", "serial", "row_split", "merge_path", "sell", "blocked", "symmetric"};
+            return names[static_cast<std::size_t>(kernel)];
+        }
+
+        /**
+         * @brief A kernel along with its block size, for Blocked.
+         *
+         */
+        struct Choice {
+            Kernel kernel = Kernel::Native;
+            std::size_t block = 1;
+        };
+
+        /**
+         * @brief Tuning choices by fingerprint, kept in memory and in a file: PACS_TUNER's value, else pacs/tuner under XDG_CACHE_HOME or ~/.cache, else .pacs_tuner.
+         *
+         */
+        class Cache {
+            private:
+
+                std::mutex mutex;
+                std::map<std::uint64_t, Choice> choices;
+                std::string path;
+
+                /**
+                 * @brief Loads the cache's file.
+                 *
+                 */
+                Cache() {
+                    const char *path = std::getenv("PACS_TUNER"), *cache = std::getenv("XDG_CACHE_HOME"), *home = std::getenv("HOME");
+
+                    if(path)
+                        this->path = path;
+                    else if((cache && *cache) || (home && *home)) {
+                        const std::filesystem::path directory = ((cache && *cache) ? std::filesystem::path{cache} : std::filesystem::path{home} / ".cache") / "pacs";
+
+                        std::error_code error;
+                        std::filesystem::create_directories(directory, error);
+                        this->path = error ? ".pacs_tuner" : (directory / "tuner").string();
+                    } else
+                        this->path = ".pacs_tuner";
+
+                    std::ifstream file{this->path};
+                    std::uint64_t fingerprint;
+                    std::size_t kernel, block;
+
+                    while(file >> fingerprint >> kernel >> block) {
+                        if(kernel <= static_cast<std::size_t>(Kernel::Symmetric))
+                            this->choices[fingerprint] = Choice{static_cast<Kernel>(kernel), block};
+                    }
+                }
+
+            public:
+
+                Cache(const Cache &) = delete;
+                Cache &operator =(const Cache &) = delete;
+
+                /**
+                 * @brief Returns the library's cache.
+                 *
+                 * @return Cache&
+                 */
+                static Cache &instance() {
+                    static Cache cache;
+                    return cache;
+                }
+
+                /**
+                 * @brief Looks a fingerprint up.
+                 *
+                 * @param fingerprint
+                 * @return std::optional<Choice>
+                 */
+                std::optional<Choice> find(const std::uint64_t &fingerprint) {
+                    std::lock_guard<std::mutex> lock{this->mutex};
+                    auto it = this->choices.find(fingerprint);
+
+                    if(it == this->choices.end())
+                        return std::nullopt;
+
+                    return it->second;
+                }
+
+                /**
+                 * @brief Stores a choice, appending it to the cache's file.
+                 *
+                 * @param fingerprint
+                 * @param choice
+                 */
+                void store(const std::uint64_t &fingerprint, const Choice &choice) {
+                    std::lock_guard<std::mutex> lock{this->mutex};
+                    this->choices[fingerprint] = choice;
+
+                    std::ofstream file{this->path, std::ios::app};
+                    file << fingerprint << " " << static_cast<std::size_t>(choice.kernel) << " " << choice.block << "\n";
+                }
+
+                /**
+                 * @brief Forgets every choice, in memory only.
+                 *
+                 */
+                void clear() {
+                    std::lock_guard<std::mutex> lock{this->mutex};
+                    this->choices.clear();
+                }
+        };
+
+        /**
+         * @brief A Matrix x Vector operator running a single kernel on its own storage, built for it.
+         * Satisfies LinearOperator, so it can replace the Matrix in solvers.
+         *
+         * @tparam T
+         * @tparam O
+         */
+        template<MatrixType T, Order O = Row>
+        class Operator {
+            private:
+
+                std::size_t height, width;
+                Choice choice;
+
+                // Native and Symmetric.
+                std::optional<Matrix<T, O>> matrix;
+
+                // CSR, for Serial, RowSplit and MergePath; SELL-C-sigma and BCSR.
+                Vector<std::size_t> inner;
+                Vector<std::size_t> outer;
+                Vector<T> values;
+
+                // MergePath's partitions, {row, element}.
+                std::vector<std::array<std::size_t, 2>> partitions;
+
+                // SELL-C-sigma's rows by position and slices' widths.
+                std::vector<std::size_t> rows_order;
+                std::vector<std::size_t> widths;
+
+                // HELPERS.
+
+                /**
+                 * @brief Returns the merge path's coordinate, {row, element}, on a given diagonal.
+                 *
+                 * @param diagonal
+                 * @return std::array<std::size_t, 2>
+                 */
+                std::array<std::size_t, 2> coordinate(const std::size_t &diagonal) const {
+                    const std::size_t elements = this->values.size();
+                    std::size_t low = diagonal > elements ? diagonal - elements : 0, high = std::min(diagonal, this->height);
+
+                    while(low < high) {
+                        const std::size_t middle = (low + high) / 2;
+
+                        if(this->inner[middle + 1] <= diagonal - middle - 1)
+                            low = middle + 1;
+                        else
+                            high = middle;
+                    }
+
+                    return {low, diagonal - low};
+                }
+
+                // BUILDERS.
+
+                /**
+                 * @brief Builds MergePath's partitions, CHUNKS_PACS per thread.
+                 *
+                 */
+                void partition() {
+                    #ifdef PARALLEL_PACS
+                    const std::size_t count = Pool::instance().threads() * CHUNKS_PACS;
+                    #else
+                    const std::size_t count = 1;
+                    #endif
+
+                    const std::size_t length = this->height + this->values.size();
+                    this->partitions.resize(count + 1);
+
+                    for(std::size_t p = 0; p <= count; ++p)
+                        this->partitions[p] = this->coordinate(p * length / count);
+                }
+
+                /**
+                 * @brief Converts CSR to SELL-C-sigma: rows sorted by decreasing length within windows, packed in column-major slices of SLICE_PACS rows, padded to each slice's longest row.
+                 *
+                 */
+                void sell() {
+                    constexpr std::size_t chunk = SLICE_PACS, window = SLICE_PACS * WINDOW_PACS;
+                    const std::size_t slices = (this->height + chunk - 1) / chunk;
+
+                    this->rows_order.resize(slices * chunk);
+                    std::iota(this->rows_order.begin(), this->rows_order.end(), 0);
+
+                    auto length = [this](const std::size_t &row) {
+                        return row < this->height ? this->inner[row + 1] - this->inner[row] : 0;
+                    };
+
+                    for(std::size_t start = 0; start < this->rows_order.size(); start += window)
+                        std::stable_sort(this->rows_order.begin() + start, this->rows_order.begin() + std::min(start + window, this->rows_order.size()), [&length](const std::size_t &first, const std::size_t &second) { return length(first) > length(second); });
+
+                    // Slices' offsets, in elements.
+                    std::vector<std::size_t> offsets;
+                    offsets.resize(slices + 1, 0);
+                    this->widths.resize(slices);
+
+                    for(std::size_t s = 0; s < slices; ++s) {
+                        this->widths[s] = 0;
+
+                        for(std::size_t r = 0; r < chunk; ++r)
+                            this->widths[s] = std::max(this->widths[s], length(this->rows_order[s * chunk + r]));
+
+                        offsets[s + 1] = offsets[s] + this->widths[s] * chunk;
+                    }
+
+                    Vector<std::size_t> outer;
+                    Vector<T> values;
+                    outer.resize(offsets[slices]);
+                    values.resize(offsets[slices]);
+
+                    // First touch under the product's partition.
+                    each(slices, [this, &offsets, &outer, &values, &length](const std::size_t &s) {
+                        for(std::size_t r = 0; r < chunk; ++r) {
+                            const std::size_t row = this->rows_order[s * chunk + r];
+
+                            for(std::size_t k = 0; k < this->widths[s]; ++k) {
+                                const bool stored = k < length(row);
+
+                                outer[offsets[s] + k * chunk + r] = stored ? this->outer[this->inner[row] + k] : 0;
+                                values[offsets[s] + k * chunk + r] = stored ? this->values[this->inner[row] + k] : static_cast<T>(0);
+                            }
+                        }
+                    });
+
+                    this->inner.assign(offsets.begin(), offsets.end());
+                    this->outer.swap(outer);
+                    this->values.swap(values);
+                }
+
+                /**
+                 * @brief Converts CSR to BCSR with square blocks, stored row-major.
+                 *
+                 * @param block
+                 */
+                void blocked(const std::size_t &block) {
+                    const std::size_t rows = (this->height + block - 1) / block;
+
+                    // Blocks' columns per block row.
+                    std::vector<std::vector<std::size_t>> columns;
+                    columns.resize(rows);
+
+                    each(rows, [this, &columns, &block](const std::size_t &b) {
+                        for(std::size_t row = b * block; row < std::min((b + 1) * block, this->height); ++row) {
+                            for(std::size_t k = this->inner[row]; k < this->inner[row + 1]; ++k)
+                                columns[b].emplace_back(this->outer[k] / block);
+                        }
+
+                        std::sort(columns[b].begin(), columns[b].end());
+                        columns[b].erase(std::unique(columns[b].begin(), columns[b].end()), columns[b].end());
+                    });
+
+                    std::vector<std::size_t> offsets;
+                    offsets.resize(rows + 1, 0);
+
+                    for(std::size_t b = 0; b < rows; ++b)
+                        offsets[b + 1] = offsets[b] + columns[b].size();
+
+                    Vector<std::size_t> outer;
+                    Vector<T> values;
+                    outer.resize(offsets[rows]);
+                    values.resize(offsets[rows] * block * block);
+
+                    each(rows, [this, &columns, &offsets, &outer, &values, &block](const std::size_t &b) {
+                        std::copy(columns[b].begin(), columns[b].end(), outer.begin() + offsets[b]);
+                        std::fill(values.begin() + offsets[b] * block * block, values.begin() + offsets[b + 1] * block * block, static_cast<T>(0));
+
+                        for(std::size_t row = b * block; row < std::min((b + 1) * block, this->height); ++row) {
+                            for(std::size_t k = this->inner[row]; k < this->inner[row + 1]; ++k) {
+                                const std::size_t position = std::lower_bound(columns[b].begin(), columns[b].end(), this->outer[k] / block) - columns[b].begin();
+                                values[(offsets[b] + position) * block * block + (row - b * block) * block + this->outer[k] % block] = this->values[k];
+                            }
+                        }
+                    });
+
+                    this->inner.assign(offsets.begin(), offsets.end());
+                    this->outer.swap(outer);
+                    this->values.swap(values);
+                }
+
+            public:
+
+                // CONSTRUCTORS.
+
+                /**
+                 * @brief Builds an operator running a given kernel on a compressed Matrix.
+                 * Symmetric falls back to Native on numerically nonsymmetric matrices.
+                 *
+                 * @param source
+                 * @param choice
+                 */
+                Operator(const Matrix<T, O> &source, const Choice &choice): height{source.rows()}, width{source.columns()}, choice{choice} {
+                    #ifndef NDEBUG
+                    assert(source.is_compressed());
+                    assert((choice.kernel != Kernel::Blocked) || (choice.block > 0));
+                    #endif
+
+                    if((choice.kernel == Kernel::Symmetric) && !(source.symmetry()))
+                        this->choice = {Kernel::Native, 1};
+
+                    if(this->choice.kernel == Kernel::Native) {
+                        this->matrix.emplace(source);
+                        return;
+                    }
+
+                    if(this->choice.kernel == Kernel::Symmetric) {
+                        this->matrix.emplace(source);
+                        this->matrix->symmetrize();
+                        return;
+                    }
+
+                    rows_of(source, this->inner, this->outer, this->values);
+
+                    if(choice.kernel == Kernel::MergePath)
+                        this->partition();
+
+                    if(choice.kernel == Kernel::Sell)
+                        this->sell();
+
+                    if(choice.kernel == Kernel::Blocked)
+                        this->blocked(choice.block);
+                }
+
+                // PRODUCT.
+
+                /**
+                 * @brief Writes the product of Matrix x Vector into result, reusing its storage.
+                 *
+                 * @param vector
+                 * @param result
+                 */
+                void product(const std::vector<T> &vector, std::vector<T> &result) const {
+                    #ifndef NDEBUG
+                    assert(vector.size() == this->width);
+                    assert(&vector != &result);
+                    #endif
+
+                    result.resize(this->height);
+
+                    switch(this->choice.kernel) {
+                        case Kernel::Native:
+                        case Kernel::Symmetric:
+                            this->matrix->product(vector, result);
+                            break;
+
+                        case Kernel::Serial:
+                            for(std::size_t j = 0; j < this->height; ++j) {
+                                T sum = static_cast<T>(0);
+
+                                for(std::size_t k = this->inner[j]; k < this->inner[j + 1]; ++k)
+                                    sum += this->values[k] * vector[this->outer[k]];
+
+                                result[j] = sum;
+                            }
+
+                            break;
+
+                        case Kernel::RowSplit:
+                            each(this->height, [this, &vector, &result](const std::size_t &j) {
+                                T sum = static_cast<T>(0);
+
+                                for(std::size_t k = this->inner[j]; k < this->inner[j + 1]; ++k)
+                                    sum += this->values[k] * vector[this->outer[k]];
+
+                                result[j] = sum;
+                            });
+
+                            break;
+
+                        case Kernel::MergePath: {
+                            const std::size_t count = this->partitions.size() - 1;
+
+                            // Partial sums of rows continuing past each partition.
+                            std::vector<std::size_t> rows;
+                            std::vector<T> carries;
+                            rows.resize(count);
+                            carries.resize(count, static_cast<T>(0));
+
+                            each(count, [this, &vector, &result, &rows, &carries](const std::size_t &p) {
+                                auto [row, k] = this->partitions[p];
+                                const auto [end_row, end] = this->partitions[p + 1];
+
+                                for(; row < end_row; ++row) {
+                                    T sum = static_cast<T>(0);
+
+                                    for(; k < this->inner[row + 1]; ++k)
+                                        sum += this->values[k] * vector[this->outer[k]];
+
+                                    result[row] = sum;
+                                }
+
+                                T carry = static_cast<T>(0);
+
+                                for(; k < end; ++k)
+                                    carry += this->values[k] * vector[this->outer[k]];
+
+                                rows[p] = row;
+                                carries[p] = carry;
+                            });
+
+                            // Fix-up, in order.
+                            for(std::size_t p = 0; p < count; ++p) {
+                                if(rows[p] < this->height)
+                                    result[rows[p]] += carries[p];
+                            }
+
+                            break;
+                        }
+
+                        case Kernel::Sell: {
+                            constexpr std::size_t chunk = SLICE_PACS;
+
+                            each(this->widths.size(), [this, &vector, &result](const std::size_t &s) {
+                                std::array<T, chunk> sums;
+                                sums.fill(static_cast<T>(0));
+
+                                for(std::size_t k = 0; k < this->widths[s]; ++k) {
+                                    const std::size_t offset = this->inner[s] + k * chunk;
+
+                                    for(std::size_t r = 0; r < chunk; ++r)
+                                        sums[r] += this->values[offset + r] * vector[this->outer[offset + r]];
+                                }
+
+                                for(std::size_t r = 0; r < chunk; ++r) {
+                                    if(this->rows_order[s * chunk + r] < this->height)
+                                        result[this->rows_order[s * chunk + r]] = sums[r];
+                                }
+                            });
+
+                            break;
+                        }
+
+                        case Kernel::Blocked: {
+                            const std::size_t block = this->choice.block;
+
+                            each(this->inner.size() - 1, [this, &vector, &result, &block](const std::size_t &b) {
+                                const std::size_t rows = std::min(block, this->height - b * block);
+
+                                for(std::size_t r = 0; r < rows; ++r)
+                                    result[b * block + r] = static_cast<T>(0);
+
+                                for(std::size_t h = this->inner[b]; h < this->inner[b + 1]; ++h) {
+                                    const std::size_t column = this->outer[h] * block;
+                                    const std::size_t columns = std::min(block, this->width - column);
+                                    const T *values = this->values.data() + h * block * block;
+
+                                    for(std::size_t r = 0; r < rows; ++r) {
+                                        T sum = static_cast<T>(0);
+
+                                        for(std::size_t c = 0; c < columns; ++c)
+                                            sum += values[r * block + c] * vector[column + c];
+
+                                        result[b * block + r] += sum;
+                                    }
+                                }
+                            });
+
+                            break;
+                        }
+                    }
+                }
+
+                /**
+                 * @brief Returns the product of Matrix x Vector.
+                 *
+                 * @param vector
+                 * @return std::vector<T>
+                 */
+                std::vector<T> operator *(const std::vector<T> &vector) const {
+                    std::vector<T> result;
+                    this->product(vector, result);
+
+                    return result;
+                }
+
+                // INFO.
+
+                /**
+                 * @brief Returns the number of rows.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t rows() const {
+                    return this->height;
+                }
+
+                /**
+                 * @brief Returns the number of columns.
+                 *
+                 * @return std::size_t
+                 */
+                inline std::size_t columns() const {
+                    return this->width;
+                }
+
+                /**
+                 * @brief Returns the operator's kernel.
+                 *
+                 * @return const Choice&
+                 */
+                inline const Choice &kernel() const {
+                    return this->choice;
+                }
+        };
+
+        /**
+         * @brief Returns a compressed Matrix' fingerprint: its sizes, storage, numerical symmetry, scalar type, row pointers, sampled column indices and the number of threads.
+         *
+         * @tparam T
+         * @tparam O
+         * @param matrix
+         * @return std::uint64_t
+         */
+        template<MatrixType T, Order O>
+        std::uint64_t fingerprint(const Matrix<T, O> &matrix) {
+            std::uint64_t hash = 0xCBF29CE484222325;
+
+            auto combine = [&hash](const std::uint64_t &value) {
+                hash = (hash ^ value) * 0x100000001B3;
+                hash ^= hash >> 29;
+            };
+
+            combine(matrix.rows());
+            combine(matrix.columns());
+            combine(static_cast<std::uint64_t>(O));
+            combine(matrix.is_symmetric());
+            combine(matrix.symmetry()); // Values decide the Symmetric kernel.
+            combine(sizeof(T));
+
+            #ifdef PARALLEL_PACS
+            combine(Pool::instance().threads());
+            #endif
+
+            for(const auto &offset: matrix.get_inner())
+                combine(offset);
+
+            const auto &outer = matrix.get_outer();
+            const std::size_t stride = std::max(outer.size() / 4096, static_cast<std::size_t>(1));
+
+            for(std::size_t k = 0; k < outer.size(); k += stride)
+                combine(outer[k]);
+
+            return hash;
+        }
+
+        /**
+         * @brief Returns the fastest Matrix x Vector operator for a compressed Matrix.
+         * Candidates are pruned by the Matrix' rows' statistics and symmetry, built and trial-run; the winner is cached by fingerprint, so that later calls, and later runs, only build it.
+         *
+         * @tparam T
+         * @tparam O
+         * @param matrix
+         * @param trials Timed batches per candidate.
+         * @param verbose Prints each candidate's time.
+         * @return Operator<T, O>
+         */
+        template<MatrixType T, Order O>
+        Operator<T, O> tune(const Matrix<T, O> &matrix, const std::size_t &trials = 5, const bool &verbose = false) {
+            #ifndef NDEBUG
+            assert(matrix.is_compressed());
+            #endif
+
+            const std::uint64_t key = fingerprint(matrix);
+
+            if(auto cached = Cache::instance().find(key))
+                return Operator<T, O>{matrix, *cached};
+
+            // Candidates.
+            std::vector<Choice> candidates = {{Kernel::Native, 1}, {Kernel::Serial, 1}};
+
+            #ifdef PARALLEL_PACS
+            if(Pool::instance().threads() > 1) {
+                candidates.push_back({Kernel::RowSplit, 1});
+                candidates.push_back({Kernel::MergePath, 1});
+            }
+            #endif
+
+            const Norms &norms = matrix.norms();
+
+            // SELL pays off on regular rows, where padding is cheap.
+            if(norms.longest <= 4 * std::max(norms.mean, 1.0))
+                candidates.push_back({Kernel::Sell, 1});
+
+            // BCSR pays off on dense blocks: at most 50% explicit zeros.
+            {
+                Matrix<T, O> expanded = matrix;
+                expanded.expand();
+
+                const auto &inner = expanded.get_inner();
+                const auto &outer = expanded.get_outer();
+                std::vector<std::size_t> blocks;
+
+                for(std::size_t block = 2; block <= 4; ++block) {
+                    std::size_t count = 0;
+
+                    for(std::size_t b = 0; b * block < inner.size() - 1; ++b) {
+                        blocks.clear();
+
+                        for(std::size_t j = b * block; j < std::min((b + 1) * block, inner.size() - 1); ++j) {
+                            for(std::size_t k = inner[j]; k < inner[j + 1]; ++k)
+                                blocks.emplace_back(outer[k] / block);
+                        }
+
+                        std::sort(blocks.begin(), blocks.end());
+                        count += std::unique(blocks.begin(), blocks.end()) - blocks.begin();
+                    }
+
+                    if(2 * expanded.size() >= count * block * block)
+                        candidates.push_back({Kernel::Blocked, block});
+                }
+            }
+
+            if((matrix.rows() == matrix.columns()) && matrix.symmetry())
+                candidates.push_back({Kernel::Symmetric, 1});
+
+            // Trial runs.
+            std::vector<T> vector, result;
+            vector.resize(matrix.columns(), static_cast<T>(1));
+
+            Choice best;
+            double fastest = std::numeric_limits<double>::max();
+
+            for(const auto &candidate: candidates) {
+                const Operator<T, O> trial{matrix, candidate};
+                trial.product(vector, result);
+
+                // Batches of at least 100 microseconds.
+                std::size_t repetitions = 1;
+                double time = std::numeric_limits<double>::max();
+
+                for(std::size_t t = 0; t < trials; ) {
+                    const auto start = std::chrono::steady_clock::now();
+
+                    for(std::size_t r = 0; r < repetitions; ++r)
+                        trial.product(vector, result);
+
+                    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+                    if(elapsed < 1E-4) {
+                        repetitions *= 2;
+                        continue;
+                    }
+
+                    time = std::min(time, elapsed / static_cast<double>(repetitions));
+                    ++t;
+                }
+
+                if(verbose)
+                    std::cout << "Tuning " << name(candidate.kernel) << (candidate.kernel == Kernel::Blocked ? std::to_string(candidate.block) : "") << ": " << time << " second(s)." << std::endl;
+
+                if(time < fastest) {
+                    fastest = time;
+                    best = candidate;
+                }
+            }
+
+            Cache::instance().store(key, best);
+            return Operator<T, O>{matrix, best};
+        }
+
+    }
+
+}
+
+#endif
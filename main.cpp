@@ -1,14 +1,18 @@
 /**
  * @file main.cpp
  * @author Andrea Di Antonio (github.com/diantonioandrea)
- * @brief 
+ * @brief
  * @date 2024-04-10
- * 
+ *
  * @copyright Copyright (c) 2024
- * 
+ *
  */
 
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <bit>
 
 // Includes.
 #include "main.hpp"
@@ -26,106 +30,158 @@ int main(int argc, char **argv) {
         std::cout << "Disabled debugging capabilities." << std::endl;
     #endif
 
-    // Test "subjects".
-    algebra::Matrix<double> row_matrix = algebra::market<double>("data/matrix.mtx");
-    algebra::Matrix<double, algebra::Column> column_matrix = algebra::market<double, algebra::Column>("data/matrix.mtx");
+    #ifdef PROFILING_PACS
+        std::cout << "Enabled hardware counters." << std::endl;
+    #endif
 
-    algebra::Matrix<double> row_matrix_1 = row_matrix;
-    algebra::Matrix<double, algebra::Column> column_matrix_1 = column_matrix;
+    // Options: --matrix file, --generate kind, --size n, --seed s, --coo 0, --huge 1, --json file, --csv file, --threads 1,2,4, --samples n, --budget seconds, --stream n.
+    std::string matrix = "data/matrix.mtx", generator, json, csv;
+    std::size_t size = 100, seed = 0, stream = 1 << 24;
+    bool coo = true, huge = false;
+    std::vector<std::size_t> threads;
+    algebra::Benchmark benchmark;
+
+    for(int j = 1; j + 1 < argc; j += 2) {
+        if(std::strcmp(argv[j], "--matrix") == 0)
+            matrix = argv[j + 1];
+        else if(std::strcmp(argv[j], "--generate") == 0)
+            generator = argv[j + 1];
+        else if(std::strcmp(argv[j], "--size") == 0)
+            size = std::stoul(argv[j + 1]);
+        else if(std::strcmp(argv[j], "--seed") == 0)
+            seed = std::stoul(argv[j + 1]);
+        else if(std::strcmp(argv[j], "--coo") == 0)
+            coo = std::stoul(argv[j + 1]) != 0;
+        else if(std::strcmp(argv[j], "--huge") == 0)
+            huge = std::stoul(argv[j + 1]) != 0;
+        else if(std::strcmp(argv[j], "--json") == 0)
+            json = argv[j + 1];
+        else if(std::strcmp(argv[j], "--csv") == 0)
+            csv = argv[j + 1];
+        else if(std::strcmp(argv[j], "--samples") == 0)
+            benchmark.samples = std::stoul(argv[j + 1]);
+        else if(std::strcmp(argv[j], "--budget") == 0)
+            benchmark.budget = std::stod(argv[j + 1]);
+        else if(std::strcmp(argv[j], "--stream") == 0)
+            stream = std::stoul(argv[j + 1]);
+        else if(std::strcmp(argv[j], "--threads") == 0) {
+            std::stringstream list{argv[j + 1]};
+            std::string count;
+
+            while(std::getline(list, count, ','))
+                threads.emplace_back(std::stoul(count));
+        } else
+            std::cerr << "Unknown option: " << argv[j] << std::endl;
+    }
 
-    std::vector<double> vector;
-    vector.resize(row_matrix.rows(), 1.5);
+    #ifdef PARALLEL_PACS
+    if(threads.empty())
+        threads.emplace_back(algebra::Pool::instance().threads());
+    #else
+    threads = {1};
+    #endif
 
-    double scalar{1.5};
+    // Test "subjects", loaded or generated.
+    auto subject = [&]<algebra::Order O>() -> algebra::Matrix<double, O> {
+        if(generator.empty())
+            return algebra::market<double, O>(matrix);
 
-    // Tests.
+        if(generator == "laplacian5")
+            return algebra::laplacian5<double, O>(size);
 
-    // Vector products.
+        if(generator == "laplacian7")
+            return algebra::laplacian7<double, O>(size);
 
-    // Uncompressed row-first matrix.
-    algebra::tester(row_matrix, vector);
+        if(generator == "laplacian27")
+            return algebra::laplacian27<double, O>(size);
 
-    // Compressed row-first matrix.
-    row_matrix.compress();
-    algebra::tester(row_matrix, vector); // This should be the fastest.
+        if(generator == "banded")
+            return algebra::banded<double, O>(size, 8, 8, seed);
 
-    // Uncompressed column-first matrix.
-    algebra::tester(column_matrix, vector);
+        if(generator == "erdos_renyi")
+            return algebra::erdos_renyi<double, O>(size, size, std::min(16.0 / static_cast<double>(size), 1.0), seed);
 
-    // Compressed column-first matrix.
-    column_matrix.compress();
-    algebra::tester(column_matrix, vector);
+        // R-MAT's scale, ceil(log2(size)).
+        if(generator == "rmat") {
+            const std::size_t scale = std::max(static_cast<std::size_t>(std::bit_width(size - 1)), static_cast<std::size_t>(1));
 
-    // Matrix products.
-    
-    row_matrix.uncompress();
-    column_matrix.uncompress();
+            if((size > 0) && (scale < 64))
+                return algebra::rmat<double, O>(scale, 16, seed);
 
-    // Uncompressed row-first x uncompressed row-first.
-    algebra::tester(row_matrix, row_matrix_1);
-    
-    // Uncompressed row-first x compressed row-first.
-    row_matrix_1.compress();
-    algebra::tester(row_matrix, row_matrix_1);
+            std::cerr << "Invalid size for rmat: " << size << ", loading [" << matrix << "]" << std::endl;
+            return algebra::market<double, O>(matrix);
+        }
 
-    // Compressed row-first x uncompressed row-first.
-    algebra::tester(row_matrix_1, row_matrix);
+        if(generator == "fem")
+            return algebra::fem<double, O>(size, 3, seed);
 
-    // compressed row-first x compressed row-first.
-    row_matrix.compress();
-    algebra::tester(row_matrix, row_matrix_1);
+        std::cerr << "Unknown generator: " << generator << ", loading [" << matrix << "]" << std::endl;
+        return algebra::market<double, O>(matrix);
+    };
 
-    // Uncompressed column-first x uncompressed column-first.
-    algebra::tester(column_matrix, column_matrix_1);
-    
-    // Uncompressed column-first x compressed column-first.
-    column_matrix_1.compress();
-    algebra::tester(column_matrix, column_matrix_1);
+    algebra::Matrix<double> row_matrix = subject.template operator()<algebra::Row>();
+    algebra::Matrix<double, algebra::Column> column_matrix = subject.template operator()<algebra::Column>();
 
-    // Compressed column-first x uncompressed column-first.
-    algebra::tester(column_matrix_1, column_matrix);
+    std::cout << "\nBenchmarking a " << row_matrix.rows() << " by " << row_matrix.columns() << ", " << row_matrix.size() << " elements Matrix [" << (generator.empty() ? matrix : generator + ", " + std::to_string(size)) << "]\n" << std::endl;
+    for([[maybe_unused]] const auto &count: threads) {
+        #ifdef PARALLEL_PACS
+        algebra::Pool::instance().configure(count);
+        #endif
 
-    // compressed column-first x compressed column-first.
-    column_matrix.compress();
-    algebra::tester(column_matrix, column_matrix_1);
+        // Roofline.
+        if(stream > 0)
+            benchmark.calibrate(stream);
 
-    // Scalar products.
+        std::cout << std::endl;
+        algebra::Benchmark::header(std::cout);
 
-    row_matrix.uncompress();
-    column_matrix.uncompress();
+        // Uncompressed matrices.
+        if(coo) {
+            row_matrix.uncompress();
+            column_matrix.uncompress();
 
-    // Uncompressed row-first matrix.
-    algebra::tester(row_matrix, scalar);
+            algebra::benchmark(benchmark, row_matrix);
+            algebra::benchmark(benchmark, column_matrix);
+        }
 
-    // Compressed row-first matrix.
-    row_matrix.compress();
-    algebra::tester(row_matrix, scalar);
+        // Compressed matrices.
+        row_matrix.compress();
+        column_matrix.compress();
 
-    // Uncompressed column-first matrix.
-    algebra::tester(column_matrix, scalar);
+        algebra::benchmark(benchmark, row_matrix);
+        algebra::benchmark(benchmark, column_matrix);
 
-    // Compressed column-first matrix.
-    column_matrix.compress();
-    algebra::tester(column_matrix, scalar);
+        // Compressed matrices on huge pages, fresh copies.
+        if(huge) {
+            const bool previous = algebra::Pages::huge();
+            algebra::Pages::configure(true);
 
-    // Norms.
+            algebra::Matrix<double> row_huge{row_matrix.rows(), row_matrix.columns(), row_matrix.get_inner(), row_matrix.get_outer(), row_matrix.get_values()};
+            algebra::Matrix<double, algebra::Column> column_huge{column_matrix.columns(), column_matrix.rows(), column_matrix.get_inner(), column_matrix.get_outer(), column_matrix.get_values()};
 
-    row_matrix.uncompress();
-    column_matrix.uncompress();
+            algebra::benchmark(benchmark, row_huge);
+            algebra::benchmark(benchmark, column_huge);
 
-    // Uncompressed row-first matrix.
-    algebra::tester(row_matrix);
+            algebra::Pages::configure(previous);
+        }
+    }
 
-    // Compressed row-first matrix.
-    row_matrix.compress();
-    algebra::tester(row_matrix);
+    // Machine-readable results.
+    if(!(json.empty())) {
+        std::ofstream file{json};
+        benchmark.json(file);
+    }
 
-    // Uncompressed column-first matrix.
-    algebra::tester(column_matrix);
+    if(!(csv.empty())) {
+        std::ofstream file{csv};
+        benchmark.csv(file);
+    }
+
+    // Hardware counters.
+    #ifdef PROFILING_PACS
+        std::cout << "\nHardware counters per kernel, over every call.\n" << std::endl;
+        algebra::Profile::instance().report();
+    #endif
 
-    // Compressed column-first matrix.
-    column_matrix.compress();
-    algebra::tester(column_matrix);
-    
     return 0;
-}
\ No newline at end of file
+}
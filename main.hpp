@@ -17,10 +17,43 @@
 // Matrices.
 #include <Matrix.hpp>
 
+// Solvers.
+#include <Solvers.hpp>
+
+// Preconditioners.
+#include <Preconditioners.hpp>
+
+// Multigrid.
+#include <Multigrid.hpp>
+
+// Reordering.
+#include <Reordering.hpp>
+
+// Direct solvers.
+#include <Direct.hpp>
+
+// Generators.
+#include <Generators.hpp>
+
 // Market format.
 #include <Market.hpp>
 
-// Testing.
-#include <Tester.hpp>
+// Autotuner.
+#include <Tuner.hpp>
+
+// Mixed precision.
+#include <Precision.hpp>
+
+// Packed indices.
+#include <Packed.hpp>
+
+// Batched matrices.
+#include <Batch.hpp>
+
+// Sparse vectors.
+#include <Sparse.hpp>
+
+// Benchmarks.
+#include <Benchmark.hpp>
 
 #endif
\ No newline at end of file